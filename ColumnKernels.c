@@ -0,0 +1,327 @@
+/**
+ ******************************************************************************
+ * @file    columnkernels.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Scalar, SSE2 and AVX2 kernels for GPA/age aggregates
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include <string.h>
+ #include "ColumnKernels.h"
+
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define HAVE_SSE2_KERNEL 1
+ #include <emmintrin.h>
+ #endif
+ 
+ /* GCC/Clang can build the AVX2 kernel for any x86 target and pick it at run
+    time; other compilers only when the whole program targets AVX2 */
+ #if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+ #define HAVE_AVX2_KERNEL 1
+ #define AVX2_TARGET __attribute__((target("avx2")))
+ #define AVX2_SUPPORTED() __builtin_cpu_supports("avx2")
+ #include <immintrin.h>
+ #elif defined(__AVX2__)
+ #define HAVE_AVX2_KERNEL 1
+ #define AVX2_TARGET
+ #define AVX2_SUPPORTED() 1
+ #include <immintrin.h>
+ #endif
+ 
+ #define EXCELLENT_GPA   3.5f
+ #define GOOD_GPA        3.0f
+ #define AVERAGE_GPA     2.0f
+ 
+ /****************************************************************************** 
+  * VARIABLES
+  ******************************************************************************/
+ static AggregateKernel_TypeDef autoKernel = AGGREGATE_KERNEL_AUTO; /* Resolved on first use */
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /*
+  * While a kernel runs, excellent/good/average hold the number of rows with
+  * GPA >= 3.5, >= 3.0 and >= 2.0. The thresholds are nested, so the bands are
+  * differences of these counts; finishAggregates converts them at the end.
+  */
+ 
+ /**
+  * @brief Seed the aggregates with the first row
+  * @param gpa GPA column
+  * @param age Age column
+  * @param count Number of rows
+  * @param pResult Aggregates to initialize
+  */
+ static void startAggregates(const float *gpa, const int *age, size_t count, StudentAggregates *pResult) {
+     memset(pResult, 0, sizeof(StudentAggregates));
+     pResult->count = count;
+     if (count != 0) {
+         pResult->gpaMin = pResult->gpaMax = gpa[0];
+         pResult->ageMin = pResult->ageMax = age[0];
+     }
+ }
+ 
+ /**
+  * @brief Turn threshold counts into band counts
+  * @param pResult Aggregates to finish
+  */
+ static void finishAggregates(StudentAggregates *pResult) {
+     int atLeastExcellent = pResult->excellent;
+     int atLeastGood = pResult->good;
+     int atLeastAverage = pResult->average;
+     pResult->good = atLeastGood - atLeastExcellent;
+     pResult->average = atLeastAverage - atLeastGood;
+     pResult->weak = (int)pResult->count - atLeastAverage;
+ }
+ 
+ /**
+  * @brief Accumulate rows [begin, end) one at a time
+  * @param gpa GPA column
+  * @param age Age column
+  * @param begin First row
+  * @param end One past the last row
+  * @param pResult Aggregates to update
+  */
+ static void aggregateScalarRange(const float *gpa, const int *age, size_t begin, size_t end,
+                                  StudentAggregates *pResult) {
+     for (size_t i = begin; i < end; i++) {
+         float value = gpa[i];
+         int years = age[i];
+         pResult->excellent += (value >= EXCELLENT_GPA);
+         pResult->good += (value >= GOOD_GPA);
+         pResult->average += (value >= AVERAGE_GPA);
+         pResult->gpaSum += value;
+         if (value < pResult->gpaMin) pResult->gpaMin = value;
+         if (value > pResult->gpaMax) pResult->gpaMax = value;
+         pResult->ageSum += years;
+         if (years < pResult->ageMin) pResult->ageMin = years;
+         if (years > pResult->ageMax) pResult->ageMax = years;
+     }
+ }
+ 
+ #ifdef HAVE_SSE2_KERNEL
+ /**
+  * @brief SSE2 kernel, 4 rows per step
+  * @param gpa GPA column
+  * @param age Age column
+  * @param count Number of rows
+  * @param pResult Aggregates to update (already seeded)
+  */
+ static void aggregateSse2(const float *gpa, const int *age, size_t count, StudentAggregates *pResult) {
+     const __m128 excellent = _mm_set1_ps(EXCELLENT_GPA);
+     const __m128 good = _mm_set1_ps(GOOD_GPA);
+     const __m128 average = _mm_set1_ps(AVERAGE_GPA);
+     __m128i countExcellent = _mm_setzero_si128();
+     __m128i countGood = _mm_setzero_si128();
+     __m128i countAverage = _mm_setzero_si128();
+     __m128d gpaSum = _mm_setzero_pd();
+     __m128 gpaMin = _mm_set1_ps(pResult->gpaMin);
+     __m128 gpaMax = _mm_set1_ps(pResult->gpaMax);
+     __m128i ageSum = _mm_setzero_si128();
+     __m128i ageMin = _mm_set1_epi32(pResult->ageMin);
+     __m128i ageMax = _mm_set1_epi32(pResult->ageMax);
+     size_t vectorEnd = count & ~(size_t)3;
+     float lanesF[4];
+     int lanesI[4];
+     long long lanesL[2];
+     double lanesD[2];
+ 
+     for (size_t i = 0; i < vectorEnd; i += 4) {
+         __m128 value = _mm_loadu_ps(gpa + i);
+         __m128i years = _mm_loadu_si128((const __m128i*)(age + i));
+         __m128i sign = _mm_srai_epi32(years, 31);
+         __m128i less, greater;
+ 
+         /* A true comparison is all ones (-1), so subtracting counts it */
+         countExcellent = _mm_sub_epi32(countExcellent, _mm_castps_si128(_mm_cmpge_ps(value, excellent)));
+         countGood = _mm_sub_epi32(countGood, _mm_castps_si128(_mm_cmpge_ps(value, good)));
+         countAverage = _mm_sub_epi32(countAverage, _mm_castps_si128(_mm_cmpge_ps(value, average)));
+         gpaSum = _mm_add_pd(gpaSum, _mm_cvtps_pd(value));
+         gpaSum = _mm_add_pd(gpaSum, _mm_cvtps_pd(_mm_movehl_ps(value, value)));
+         gpaMin = _mm_min_ps(gpaMin, value);
+         gpaMax = _mm_max_ps(gpaMax, value);
+ 
+         /* SSE2 has no 32-bit min/max or sign extension: select and unpack */
+         ageSum = _mm_add_epi64(ageSum, _mm_unpacklo_epi32(years, sign));
+         ageSum = _mm_add_epi64(ageSum, _mm_unpackhi_epi32(years, sign));
+         less = _mm_cmplt_epi32(years, ageMin);
+         ageMin = _mm_or_si128(_mm_and_si128(less, years), _mm_andnot_si128(less, ageMin));
+         greater = _mm_cmpgt_epi32(years, ageMax);
+         ageMax = _mm_or_si128(_mm_and_si128(greater, years), _mm_andnot_si128(greater, ageMax));
+     }
+ 
+     _mm_storeu_si128((__m128i*)lanesI, countExcellent);
+     pResult->excellent += lanesI[0] + lanesI[1] + lanesI[2] + lanesI[3];
+     _mm_storeu_si128((__m128i*)lanesI, countGood);
+     pResult->good += lanesI[0] + lanesI[1] + lanesI[2] + lanesI[3];
+     _mm_storeu_si128((__m128i*)lanesI, countAverage);
+     pResult->average += lanesI[0] + lanesI[1] + lanesI[2] + lanesI[3];
+     _mm_storeu_pd(lanesD, gpaSum);
+     pResult->gpaSum += lanesD[0] + lanesD[1];
+     _mm_storeu_si128((__m128i*)lanesL, ageSum);
+     pResult->ageSum += lanesL[0] + lanesL[1];
+     _mm_storeu_ps(lanesF, gpaMin);
+     for (int lane = 0; lane < 4; lane++) if (lanesF[lane] < pResult->gpaMin) pResult->gpaMin = lanesF[lane];
+     _mm_storeu_ps(lanesF, gpaMax);
+     for (int lane = 0; lane < 4; lane++) if (lanesF[lane] > pResult->gpaMax) pResult->gpaMax = lanesF[lane];
+     _mm_storeu_si128((__m128i*)lanesI, ageMin);
+     for (int lane = 0; lane < 4; lane++) if (lanesI[lane] < pResult->ageMin) pResult->ageMin = lanesI[lane];
+     _mm_storeu_si128((__m128i*)lanesI, ageMax);
+     for (int lane = 0; lane < 4; lane++) if (lanesI[lane] > pResult->ageMax) pResult->ageMax = lanesI[lane];
+ 
+     aggregateScalarRange(gpa, age, vectorEnd, count, pResult);
+ }
+ #endif /* HAVE_SSE2_KERNEL */
+ 
+ #ifdef HAVE_AVX2_KERNEL
+ /**
+  * @brief AVX2 kernel, 8 rows per step
+  * @param gpa GPA column
+  * @param age Age column
+  * @param count Number of rows
+  * @param pResult Aggregates to update (already seeded)
+  */
+ AVX2_TARGET
+ static void aggregateAvx2(const float *gpa, const int *age, size_t count, StudentAggregates *pResult) {
+     const __m256 excellent = _mm256_set1_ps(EXCELLENT_GPA);
+     const __m256 good = _mm256_set1_ps(GOOD_GPA);
+     const __m256 average = _mm256_set1_ps(AVERAGE_GPA);
+     __m256i countExcellent = _mm256_setzero_si256();
+     __m256i countGood = _mm256_setzero_si256();
+     __m256i countAverage = _mm256_setzero_si256();
+     __m256d gpaSum = _mm256_setzero_pd();
+     __m256 gpaMin = _mm256_set1_ps(pResult->gpaMin);
+     __m256 gpaMax = _mm256_set1_ps(pResult->gpaMax);
+     __m256i ageSum = _mm256_setzero_si256();
+     __m256i ageMin = _mm256_set1_epi32(pResult->ageMin);
+     __m256i ageMax = _mm256_set1_epi32(pResult->ageMax);
+     size_t vectorEnd = count & ~(size_t)7;
+     float lanesF[8];
+     int lanesI[8];
+     long long lanesL[4];
+     double lanesD[4];
+ 
+     for (size_t i = 0; i < vectorEnd; i += 8) {
+         __m256 value = _mm256_loadu_ps(gpa + i);
+         __m256i years = _mm256_loadu_si256((const __m256i*)(age + i));
+ 
+         /* Ordered compares: NaN counts as weak, like the scalar chain */
+         countExcellent = _mm256_sub_epi32(countExcellent, _mm256_castps_si256(_mm256_cmp_ps(value, excellent, _CMP_GE_OQ)));
+         countGood = _mm256_sub_epi32(countGood, _mm256_castps_si256(_mm256_cmp_ps(value, good, _CMP_GE_OQ)));
+         countAverage = _mm256_sub_epi32(countAverage, _mm256_castps_si256(_mm256_cmp_ps(value, average, _CMP_GE_OQ)));
+         gpaSum = _mm256_add_pd(gpaSum, _mm256_cvtps_pd(_mm256_castps256_ps128(value)));
+         gpaSum = _mm256_add_pd(gpaSum, _mm256_cvtps_pd(_mm256_extractf128_ps(value, 1)));
+         gpaMin = _mm256_min_ps(gpaMin, value);
+         gpaMax = _mm256_max_ps(gpaMax, value);
+         ageSum = _mm256_add_epi64(ageSum, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(years)));
+         ageSum = _mm256_add_epi64(ageSum, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(years, 1)));
+         ageMin = _mm256_min_epi32(ageMin, years);
+         ageMax = _mm256_max_epi32(ageMax, years);
+     }
+ 
+     _mm256_storeu_si256((__m256i*)lanesI, countExcellent);
+     for (int lane = 0; lane < 8; lane++) pResult->excellent += lanesI[lane];
+     _mm256_storeu_si256((__m256i*)lanesI, countGood);
+     for (int lane = 0; lane < 8; lane++) pResult->good += lanesI[lane];
+     _mm256_storeu_si256((__m256i*)lanesI, countAverage);
+     for (int lane = 0; lane < 8; lane++) pResult->average += lanesI[lane];
+     _mm256_storeu_pd(lanesD, gpaSum);
+     pResult->gpaSum += (lanesD[0] + lanesD[1]) + (lanesD[2] + lanesD[3]);
+     _mm256_storeu_si256((__m256i*)lanesL, ageSum);
+     pResult->ageSum += lanesL[0] + lanesL[1] + lanesL[2] + lanesL[3];
+     _mm256_storeu_ps(lanesF, gpaMin);
+     for (int lane = 0; lane < 8; lane++) if (lanesF[lane] < pResult->gpaMin) pResult->gpaMin = lanesF[lane];
+     _mm256_storeu_ps(lanesF, gpaMax);
+     for (int lane = 0; lane < 8; lane++) if (lanesF[lane] > pResult->gpaMax) pResult->gpaMax = lanesF[lane];
+     _mm256_storeu_si256((__m256i*)lanesI, ageMin);
+     for (int lane = 0; lane < 8; lane++) if (lanesI[lane] < pResult->ageMin) pResult->ageMin = lanesI[lane];
+     _mm256_storeu_si256((__m256i*)lanesI, ageMax);
+     for (int lane = 0; lane < 8; lane++) if (lanesI[lane] > pResult->ageMax) pResult->ageMax = lanesI[lane];
+ 
+     aggregateScalarRange(gpa, age, vectorEnd, count, pResult);
+ }
+ #endif /* HAVE_AVX2_KERNEL */
+ 
+ /**
+  * @brief Get the kernel AGGREGATE_KERNEL_AUTO resolves to
+  * @return Kernel used by aggregateColumns
+  */
+ AggregateKernel_TypeDef selectedAggregateKernel(void) {
+     if (autoKernel == AGGREGATE_KERNEL_AUTO) {
+         AggregateKernel_TypeDef kernel = AGGREGATE_KERNEL_SCALAR;
+ #ifdef HAVE_SSE2_KERNEL
+         kernel = AGGREGATE_KERNEL_SSE2;
+ #endif
+ #ifdef HAVE_AVX2_KERNEL
+         if (AVX2_SUPPORTED()) kernel = AGGREGATE_KERNEL_AVX2;
+ #endif
+         autoKernel = kernel;
+     }
+     return autoKernel;
+ }
+ 
+ /**
+  * @brief Same as aggregateColumns with a specific kernel
+  * @param kernel Kernel to use
+  * @param gpa GPA column
+  * @param age Age column
+  * @param count Number of rows
+  * @param pResult Receives the aggregates
+  * @return 1 on success, 0 if the kernel is not available on this build or CPU
+  */
+ int aggregateColumnsWith(AggregateKernel_TypeDef kernel, const float *gpa, const int *age,
+                          size_t count, StudentAggregates *pResult) {
+     if (kernel == AGGREGATE_KERNEL_AUTO) {
+         kernel = selectedAggregateKernel();
+     }
+     startAggregates(gpa, age, count, pResult);
+     switch (kernel) {
+         case AGGREGATE_KERNEL_SCALAR:
+             aggregateScalarRange(gpa, age, 0, count, pResult);
+             break;
+ #ifdef HAVE_SSE2_KERNEL
+         case AGGREGATE_KERNEL_SSE2:
+             aggregateSse2(gpa, age, count, pResult);
+             break;
+ #endif
+ #ifdef HAVE_AVX2_KERNEL
+         case AGGREGATE_KERNEL_AVX2:
+             if (!AVX2_SUPPORTED()) return 0;
+             aggregateAvx2(gpa, age, count, pResult);
+             break;
+ #endif
+         default:
+             return 0;
+     }
+     finishAggregates(pResult);
+     return 1;
+ }
+ 
+ /**
+  * @brief Compute band counts, sum, min and max of GPA and age in one pass
+  * @param gpa GPA column
+  * @param age Age column
+  * @param count Number of rows
+  * @param pResult Receives the aggregates
+  */
+ void aggregateColumns(const float *gpa, const int *age, size_t count, StudentAggregates *pResult) {
+     aggregateColumnsWith(AGGREGATE_KERNEL_AUTO, gpa, age, count, pResult);
+ }
@@ -0,0 +1,92 @@
+/**
+ ******************************************************************************
+ * @file    columnkernels.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for the vectorized GPA/age aggregate kernels
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef COLUMNKERNELS_H
+ #define COLUMNKERNELS_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include <stddef.h>
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Kernel used to compute the aggregates
+  */
+ typedef enum {
+     AGGREGATE_KERNEL_AUTO,    /* Best kernel the CPU supports */
+     AGGREGATE_KERNEL_SCALAR,  /* Plain C loop */
+     AGGREGATE_KERNEL_SSE2,    /* 4 rows per step */
+     AGGREGATE_KERNEL_AVX2     /* 8 rows per step */
+ } AggregateKernel_TypeDef;
+ 
+ /**
+  * @brief Result of one aggregate pass over the GPA and age columns
+  * @note  Bands use the report thresholds: excellent >= 3.5, good >= 3.0,
+  *        average >= 2.0, weak otherwise. Counts are exact for every kernel;
+  *        gpaSum may differ in the last bits because lanes are summed in a
+  *        different order.
+  */
+ typedef struct StudentAggregates {
+     size_t count;          /* Number of rows */
+     int excellent;         /* GPA >= 3.5 */
+     int good;              /* 3.0 <= GPA < 3.5 */
+     int average;           /* 2.0 <= GPA < 3.0 */
+     int weak;              /* GPA < 2.0 */
+     double gpaSum;         /* Sum of GPA */
+     float gpaMin;          /* Lowest GPA, 0 if count is 0 */
+     float gpaMax;          /* Highest GPA, 0 if count is 0 */
+     long long ageSum;      /* Sum of ages */
+     int ageMin;            /* Lowest age, 0 if count is 0 */
+     int ageMax;            /* Highest age, 0 if count is 0 */
+ } StudentAggregates;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Compute band counts, sum, min and max of GPA and age in one pass
+  * @param gpa GPA column
+  * @param age Age column
+  * @param count Number of rows
+  * @param pResult Receives the aggregates
+  */
+ void aggregateColumns(const float *gpa, const int *age, size_t count, StudentAggregates *pResult);
+ 
+ /**
+  * @brief Same as aggregateColumns with a specific kernel
+  * @param kernel Kernel to use
+  * @param gpa GPA column
+  * @param age Age column
+  * @param count Number of rows
+  * @param pResult Receives the aggregates
+  * @return 1 on success, 0 if the kernel is not available on this build or CPU
+  */
+ int aggregateColumnsWith(AggregateKernel_TypeDef kernel, const float *gpa, const int *age,
+                          size_t count, StudentAggregates *pResult);
+ 
+ /**
+  * @brief Get the kernel AGGREGATE_KERNEL_AUTO resolves to
+  * @return Kernel used by aggregateColumns
+  */
+ AggregateKernel_TypeDef selectedAggregateKernel(void);
+ 
+ #endif /* COLUMNKERNELS_H */
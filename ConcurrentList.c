@@ -0,0 +1,335 @@
+/**
+ ******************************************************************************
+ * @file    concurrentlist.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of the thread-safe student linked list
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+ #define _POSIX_C_SOURCE 200809L
+ #endif
+ #include <stddef.h>
+ #include "ConcurrentList.h"
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Node lock helpers over the pthread and Win32 primitives
+  */
+ #ifdef _WIN32
+ static int initNodeLock(CNode *pNode) { InitializeSRWLock(&pNode->lock); return 1; }
+ static void destroyNodeLock(CNode *pNode) { (void)pNode; }
+ static void lockNode(CNode *pNode) { AcquireSRWLockExclusive(&pNode->lock); }
+ static void unlockNode(CNode *pNode) { ReleaseSRWLockExclusive(&pNode->lock); }
+ #else
+ static int initNodeLock(CNode *pNode) { return pthread_mutex_init(&pNode->lock, NULL) == 0; }
+ static void destroyNodeLock(CNode *pNode) { pthread_mutex_destroy(&pNode->lock); }
+ static void lockNode(CNode *pNode) { pthread_mutex_lock(&pNode->lock); }
+ static void unlockNode(CNode *pNode) { pthread_mutex_unlock(&pNode->lock); }
+ #endif
+ 
+ /**
+  * @brief Create a concurrent list node
+  * @param student Student data
+  * @return Pointer to the new node, NULL if out of memory
+  * @note  Nodes come from malloc, not the NodePool: the pool is not thread-safe
+  */
+ static CNode* createCNode(Student student) {
+     CNode *pNode = (CNode*)malloc(sizeof(CNode));
+     if (pNode == NULL || !initNodeLock(pNode)) {
+         free(pNode);
+         printf("Memory allocation failed!\n");
+         return NULL;
+     }
+     pNode->dataStudent = student;
+     atomic_init(&pNode->pNextNode, NULL);
+     pNode->removed = 0;
+     return pNode;
+ }
+ 
+ /**
+  * @brief Free a concurrent list node
+  * @param pNode Node to free
+  */
+ static void freeCNode(CNode *pNode) {
+     destroyNodeLock(pNode);
+     free(pNode);
+ }
+ 
+ /**
+  * @brief Free a node handed back by the epoch domain
+  * @param pEntry Link embedded in the node
+  */
+ static void freeRetiredCNode(EpochEntry *pEntry) {
+     freeCNode((CNode*)((char*)pEntry - offsetof(CNode, retireEntry)));
+ }
+ 
+ /**
+  * @brief Initialize the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @return 1 on success, 0 if the sentinel's lock could not be created
+  */
+ int initConcurrentList(ConcurrentList *pList) {
+     memset(&pList->head.dataStudent, 0, sizeof(pList->head.dataStudent));
+     atomic_init(&pList->head.pNextNode, NULL);
+     pList->head.removed = 0;
+     atomic_init(&pList->pTail, &pList->head); /* Empty: the sentinel is last */
+     atomic_init(&pList->nodeCount, 0);
+     initEpochDomain(&pList->epoch, freeRetiredCNode);
+     return initNodeLock(&pList->head);
+ }
+ 
+ /**
+  * @brief Free every node and the locks of the concurrent list
+  * @param pList Pointer to the concurrent list
+  */
+ void cFreeList(ConcurrentList *pList) {
+     CNode *pNode = atomic_load(&pList->head.pNextNode);
+     destroyEpochDomain(&pList->epoch); /* Frees the retired nodes */
+     while (pNode != NULL) {
+         CNode *pNext = atomic_load_explicit(&pNode->pNextNode, memory_order_relaxed);
+         freeCNode(pNode);
+         pNode = pNext;
+     }
+     destroyNodeLock(&pList->head);
+ }
+ 
+ /**
+  * @brief Link a new node after a locked node
+  * @param pList Pointer to the concurrent list
+  * @param pPrev Node to link after, locked by the caller
+  * @param pNewNode Node to link
+  */
+ static void linkAfterLocked(ConcurrentList *pList, CNode *pPrev, CNode *pNewNode) {
+     CNode *pNext = atomic_load_explicit(&pPrev->pNextNode, memory_order_relaxed);
+     atomic_store_explicit(&pNewNode->pNextNode, pNext, memory_order_relaxed);
+     atomic_store_explicit(&pPrev->pNextNode, pNewNode, memory_order_release); /* Publish the filled node */
+     if (pNext == NULL) atomic_store(&pList->pTail, pNewNode); /* pPrev was last; its lock guards pTail */
+     atomic_fetch_add(&pList->nodeCount, 1);
+ }
+ 
+ /**
+  * @brief Walk hand over hand to a student by name
+  * @param pList Pointer to the concurrent list, inside its epoch domain
+  * @param name Name to look for
+  * @return The node, still locked, or NULL with no lock held
+  */
+ static CNode* lockNodeByName(ConcurrentList *pList, const char *name) {
+     CNode *pCurrent = &pList->head;
+     lockNode(pCurrent);
+     for (;;) {
+         CNode *pNext = atomic_load_explicit(&pCurrent->pNextNode, memory_order_acquire);
+         if (pNext == NULL) {
+             unlockNode(pCurrent);
+             return NULL;
+         }
+         lockNode(pNext); /* Take the next lock before dropping this one */
+         unlockNode(pCurrent);
+         pCurrent = pNext;
+         if (strcmp(pCurrent->dataStudent.nameStudent, name) == 0) return pCurrent;
+     }
+ }
+ 
+ /**
+  * @brief Add a student to the head of the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @param student Student data
+  * @return 1 on success, 0 if out of memory
+  */
+ int cAddHead(ConcurrentList *pList, Student student) {
+     CNode *pNewNode = createCNode(student);
+     if (pNewNode == NULL) return 0;
+     lockNode(&pList->head); /* The sentinel is never freed: no epoch needed */
+     linkAfterLocked(pList, &pList->head, pNewNode);
+     unlockNode(&pList->head);
+     return 1;
+ }
+ 
+ /**
+  * @brief Add a student to the tail of the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @param student Student data
+  * @return 1 on success, 0 if out of memory
+  */
+ int cAddTail(ConcurrentList *pList, Student student) {
+     CNode *pNewNode = createCNode(student);
+     EpochRecord *pRecord;
+     if (pNewNode == NULL) return 0;
+     pRecord = ebrEnter(&pList->epoch); /* pTail may be retired while we wait for its lock */
+     for (;;) {
+         CNode *pLast = atomic_load(&pList->pTail);
+         lockNode(pLast);
+         if (!pLast->removed && atomic_load_explicit(&pLast->pNextNode, memory_order_relaxed) == NULL) {
+             linkAfterLocked(pList, pLast, pNewNode);
+             unlockNode(pLast);
+             break;
+         }
+         unlockNode(pLast); /* Tail moved while we waited: try the new one */
+     }
+     ebrExit(pRecord);
+     return 1;
+ }
+ 
+ /**
+  * @brief Insert a new student after a student with a specific name
+  * @param pList Pointer to the concurrent list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert after
+  * @return 1 on success, 0 if the target is missing or out of memory
+  */
+ int cInsertAfterStudent(ConcurrentList *pList, Student newStudent, const char *nameTarget) {
+     CNode *pNewNode = createCNode(newStudent);
+     EpochRecord *pRecord;
+     CNode *pTarget;
+     if (pNewNode == NULL) return 0;
+     pRecord = ebrEnter(&pList->epoch);
+     pTarget = lockNodeByName(pList, nameTarget);
+     if (pTarget != NULL) {
+         linkAfterLocked(pList, pTarget, pNewNode);
+         unlockNode(pTarget);
+     }
+     ebrExit(pRecord);
+     if (pTarget == NULL) {
+         freeCNode(pNewNode);
+         printf("Student with name %s not found!\n", nameTarget);
+         return 0;
+     }
+     return 1;
+ }
+ 
+ /**
+  * @brief Unlink the node after a locked node and retire it
+  * @param pList Pointer to the concurrent list
+  * @param pRecord Caller's epoch record
+  * @param pPrev Node before the victim, locked by the caller
+  * @return 1 if a node was removed, 0 if pPrev is last
+  */
+ static int unlinkAfterLocked(ConcurrentList *pList, EpochRecord *pRecord, CNode *pPrev) {
+     CNode *pVictim = atomic_load_explicit(&pPrev->pNextNode, memory_order_relaxed);
+     if (pVictim == NULL) return 0;
+     lockNode(pVictim); /* Waits out anyone linking after it */
+     atomic_store_explicit(&pPrev->pNextNode, atomic_load_explicit(&pVictim->pNextNode, memory_order_relaxed),
+                           memory_order_release);
+     pVictim->removed = 1;
+     if (atomic_load(&pList->pTail) == pVictim) atomic_store(&pList->pTail, pPrev);
+     atomic_fetch_sub(&pList->nodeCount, 1);
+     unlockNode(pVictim);
+     ebrRetire(pRecord, &pVictim->retireEntry); /* Readers may still be on it; its next link still leads them on */
+     return 1;
+ }
+ 
+ /**
+  * @brief Delete the head of the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @param pOut Receives the removed student, may be NULL
+  * @return 1 on success, 0 if the list is empty
+  */
+ int cDeleteHead(ConcurrentList *pList, Student *pOut) {
+     EpochRecord *pRecord = ebrEnter(&pList->epoch);
+     int removed;
+     lockNode(&pList->head);
+     if (pOut != NULL) {
+         CNode *pFirst = atomic_load_explicit(&pList->head.pNextNode, memory_order_relaxed);
+         if (pFirst != NULL) *pOut = pFirst->dataStudent;
+     }
+     removed = unlinkAfterLocked(pList, pRecord, &pList->head);
+     unlockNode(&pList->head);
+     ebrExit(pRecord);
+     return removed;
+ }
+ 
+ /**
+  * @brief Delete the student after a student with a specific name
+  * @param pList Pointer to the concurrent list
+  * @param nameTarget Name of the target student
+  * @return 1 on success, 0 if the target is missing or last
+  */
+ int cDeleteAfterStudent(ConcurrentList *pList, const char *nameTarget) {
+     EpochRecord *pRecord = ebrEnter(&pList->epoch);
+     CNode *pTarget = lockNodeByName(pList, nameTarget);
+     int removed = 0;
+     if (pTarget != NULL) {
+         removed = unlinkAfterLocked(pList, pRecord, pTarget);
+         unlockNode(pTarget);
+     }
+     ebrExit(pRecord);
+     if (pTarget == NULL) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return 0;
+     }
+     if (!removed) {
+         printf("No student after %s!\n", nameTarget);
+         return 0;
+     }
+     return 1;
+ }
+ 
+ /**
+  * @brief Get the number of students in the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @return Number of students
+  */
+ int cCountNodes(ConcurrentList *pList) {
+     return atomic_load(&pList->nodeCount);
+ }
+ 
+ /**
+  * @brief Find a student by name
+  * @param pList Pointer to the concurrent list
+  * @param name Name to look for
+  * @param pOut Receives a copy of the student, may be NULL
+  * @return 1 if found, 0 otherwise
+  */
+ int cFindStudent(ConcurrentList *pList, const char *name, Student *pOut) {
+     EpochRecord *pRecord = ebrEnter(&pList->epoch);
+     int found = 0;
+     for (CNode *pNode = atomic_load_explicit(&pList->head.pNextNode, memory_order_acquire); pNode != NULL;
+          pNode = atomic_load_explicit(&pNode->pNextNode, memory_order_acquire)) {
+         if (strcmp(pNode->dataStudent.nameStudent, name) == 0) {
+             if (pOut != NULL) *pOut = pNode->dataStudent;
+             found = 1;
+             break;
+         }
+     }
+     ebrExit(pRecord);
+     return found;
+ }
+ 
+ /**
+  * @brief Call a function for every student in list order
+  * @param pList Pointer to the concurrent list
+  * @param visit Callback, must not modify the list
+  * @param pContext Passed through to the callback
+  */
+ void cForEachStudent(ConcurrentList *pList, CListVisit_TypeDef visit, void *pContext) {
+     EpochRecord *pRecord = ebrEnter(&pList->epoch);
+     for (CNode *pNode = atomic_load_explicit(&pList->head.pNextNode, memory_order_acquire); pNode != NULL;
+          pNode = atomic_load_explicit(&pNode->pNextNode, memory_order_acquire)) {
+         visit(&pNode->dataStudent, pContext);
+     }
+     ebrExit(pRecord);
+ }
+ 
+ /**
+  * @brief Free the nodes unlinked by earlier deletes
+  * @param pList Pointer to the concurrent list
+  */
+ void cReclaimNodes(ConcurrentList *pList) {
+     ebrCollect(&pList->epoch);
+ }
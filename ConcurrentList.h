@@ -0,0 +1,169 @@
+/**
+ ******************************************************************************
+ * @file    concurrentlist.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for the thread-safe student linked list
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef CONCURRENTLIST_H
+ #define CONCURRENTLIST_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #ifdef _WIN32
+ #include <windows.h>
+ #else
+ #include <pthread.h>
+ #endif
+ #include <stdatomic.h>
+ #include "linkedlist.h"
+ #include "EpochReclaim.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Concurrent list node with its own lock
+  */
+ typedef struct CNode {
+     Student dataStudent;                /* Student data, never changed once linked */
+     _Atomic(struct CNode*) pNextNode;   /* Pointer to the next node */
+     int removed;                        /* Set under lock once the node is unlinked */
+     EpochEntry retireEntry;             /* Links the node while it waits to be freed */
+ #ifdef _WIN32
+     SRWLOCK lock;                       /* Hand-over-hand lock, exclusive mode only */
+ #else
+     pthread_mutex_t lock;               /* Hand-over-hand lock */
+ #endif
+ } CNode;
+ 
+ /**
+  * @brief Thread-safe singly linked list of students
+  * @note  Every operation runs inside the list's epoch domain. Readers take
+  *        no lock at all and walk the atomic links. Link changes lock the
+  *        nodes they touch hand over hand in list order, so writers in
+  *        different parts of the list run in parallel with each other and
+  *        with readers. Unlinked nodes are retired to the epoch domain and
+  *        freed once every thread that could still see them has left.
+  */
+ typedef struct ConcurrentList {
+     CNode head;                         /* Sentinel; head.pNextNode is the first student */
+     _Atomic(CNode*) pTail;              /* Last node, &head when empty; changed under its lock */
+     atomic_int nodeCount;               /* Number of students in the list */
+     EpochDomain epoch;                  /* Protects readers from freed nodes */
+ } ConcurrentList;
+ 
+ /**
+  * @brief Callback applied to each student by cForEachStudent
+  * @param pStudent Student in the list
+  * @param pContext Caller's context pointer
+  */
+ typedef void (*CListVisit_TypeDef)(const Student *pStudent, void *pContext);
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Initialize the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @return 1 on success, 0 if the sentinel's lock could not be created
+  */
+ int initConcurrentList(ConcurrentList *pList);
+ 
+ /**
+  * @brief Free every node and the locks of the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @note  No other thread may use the list during or after this call
+  */
+ void cFreeList(ConcurrentList *pList);
+ 
+ /**
+  * @brief Add a student to the head of the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @param student Student data
+  * @return 1 on success, 0 if out of memory
+  */
+ int cAddHead(ConcurrentList *pList, Student student);
+ 
+ /**
+  * @brief Add a student to the tail of the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @param student Student data
+  * @return 1 on success, 0 if out of memory
+  */
+ int cAddTail(ConcurrentList *pList, Student student);
+ 
+ /**
+  * @brief Insert a new student after a student with a specific name
+  * @param pList Pointer to the concurrent list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert after
+  * @return 1 on success, 0 if the target is missing or out of memory
+  */
+ int cInsertAfterStudent(ConcurrentList *pList, Student newStudent, const char *nameTarget);
+ 
+ /**
+  * @brief Delete the head of the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @param pOut Receives the removed student, may be NULL
+  * @return 1 on success, 0 if the list is empty
+  */
+ int cDeleteHead(ConcurrentList *pList, Student *pOut);
+ 
+ /**
+  * @brief Delete the student after a student with a specific name
+  * @param pList Pointer to the concurrent list
+  * @param nameTarget Name of the target student
+  * @return 1 on success, 0 if the target is missing or last
+  */
+ int cDeleteAfterStudent(ConcurrentList *pList, const char *nameTarget);
+ 
+ /**
+  * @brief Get the number of students in the concurrent list
+  * @param pList Pointer to the concurrent list
+  * @return Number of students
+  */
+ int cCountNodes(ConcurrentList *pList);
+ 
+ /**
+  * @brief Find a student by name
+  * @param pList Pointer to the concurrent list
+  * @param name Name to look for
+  * @param pOut Receives a copy of the student, may be NULL
+  * @return 1 if found, 0 otherwise
+  * @note  A copy is returned because the node may be deleted right after
+  */
+ int cFindStudent(ConcurrentList *pList, const char *name, Student *pOut);
+ 
+ /**
+  * @brief Call a function for every student in list order
+  * @param pList Pointer to the concurrent list
+  * @param visit Callback, must not modify the list
+  * @param pContext Passed through to the callback
+  * @note  Students linked or unlinked during the walk may or may not be seen
+  */
+ void cForEachStudent(ConcurrentList *pList, CListVisit_TypeDef visit, void *pContext);
+ 
+ /**
+  * @brief Free the nodes unlinked by earlier deletes
+  * @param pList Pointer to the concurrent list
+  * @note  Never waits: nodes a running reader may still see are kept. Deletes
+  *        also free old nodes as they go, so this is only needed to trim
+  *        memory after a burst of deletes
+  */
+ void cReclaimNodes(ConcurrentList *pList);
+ 
+ #endif /* CONCURRENTLIST_H */
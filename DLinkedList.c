@@ -0,0 +1,472 @@
+/**
+ ******************************************************************************
+ * @file    dlinkedlist.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of doubly linked list management functions
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include "DLinkedList.h"
+
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Link a node before another node
+  * @param pList Pointer to the doubly linked list
+  * @param pNext Node to link before, NULL to link at the tail
+  * @param pNode Node to link
+  */
+ static void linkBefore(DLinkedList *pList, DNode *pNext, DNode *pNode) {
+     DNode *pPrev = (pNext != NULL) ? pNext->pPrevNode : pList->pTail;
+     pNode->pNextNode = pNext;
+     pNode->pPrevNode = pPrev;
+     if (pPrev != NULL) pPrev->pNextNode = pNode;
+     else pList->pHead = pNode;
+     if (pNext != NULL) pNext->pPrevNode = pNode;
+     else pList->pTail = pNode;
+     pList->nodeCount++;
+ }
+ 
+ /**
+  * @brief Unlink and free a node in O(1)
+  * @param pList Pointer to the doubly linked list
+  * @param pNode Node to remove
+  */
+ static void removeNode(DLinkedList *pList, DNode *pNode) {
+     if (pNode->pPrevNode != NULL) pNode->pPrevNode->pNextNode = pNode->pNextNode;
+     else pList->pHead = pNode->pNextNode;
+     if (pNode->pNextNode != NULL) pNode->pNextNode->pPrevNode = pNode->pPrevNode;
+     else pList->pTail = pNode->pPrevNode;
+     pList->nodeCount--;
+     free(pNode);
+ }
+ 
+ /**
+  * @brief Find the first node with a specific name
+  * @param pList Pointer to the doubly linked list
+  * @param name Name to look for
+  * @return Matching node, or NULL if not found
+  */
+ static DNode* findByName(DLinkedList *pList, const char *name) {
+     for (DNode *current = pList->pHead; current != NULL; current = current->pNextNode) {
+         if (strcmp(current->dataStudent.nameStudent, name) == 0) {
+             return current;
+         }
+     }
+     return NULL;
+ }
+ 
+ /**
+  * @brief Find the node at a 1-based position, walking from the nearer end
+  * @param pList Pointer to the doubly linked list
+  * @param position Position of the node
+  * @return Node at the position, or NULL if out of range
+  */
+ static DNode* nodeAt(DLinkedList *pList, int position) {
+     int count = pList->nodeCount;
+     DNode *current;
+     if (position < 1 || position > count) return NULL;
+     if (position <= count / 2) {
+         current = pList->pHead;
+         for (int i = 1; i < position; i++) current = current->pNextNode;
+     } else {
+         current = pList->pTail;
+         for (int i = count; i > position; i--) current = current->pPrevNode;
+     }
+     return current;
+ }
+ 
+ /**
+  * @brief Initialize the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  */
+ void initDLinkedList(DLinkedList *pList) {
+     pList->pHead = NULL; /* Set head to NULL */
+     pList->pTail = NULL; /* Set tail to NULL */
+     pList->nodeCount = 0; /* Start empty */
+ }
+ 
+ /**
+  * @brief Create a new doubly linked node with the given student data
+  * @param student Student data to be stored in the node
+  * @return Pointer to the newly created node
+  */
+ DNode* createDNode(Student student) {
+     DNode *newNode = (DNode*)malloc(sizeof(DNode));
+     if (newNode == NULL) {
+         printf("Memory allocation failed!\n");
+         exit(1);
+     }
+     newNode->dataStudent = student; /* Assign student data */
+     newNode->pNextNode = NULL;      /* Set next pointer to NULL */
+     newNode->pPrevNode = NULL;      /* Set previous pointer to NULL */
+     return newNode;
+ }
+ 
+ /**
+  * @brief Add a node to the head of the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  * @param pNewNode Pointer to the new node
+  */
+ void dAddHead(DLinkedList *pList, DNode *pNewNode) {
+     linkBefore(pList, pList->pHead, pNewNode);
+ }
+ 
+ /**
+  * @brief Add a node to the tail of the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  * @param pNewNode Pointer to the new node
+  */
+ void dAddTail(DLinkedList *pList, DNode *pNewNode) {
+     linkBefore(pList, NULL, pNewNode);
+ }
+ 
+ /**
+  * @brief Insert a new student before a student with a specific name
+  * @param pList Pointer to the doubly linked list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert before
+  */
+ void dInsertBeforeStudent(DLinkedList *pList, Student newStudent, const char *nameTarget) {
+     DNode *target = findByName(pList, nameTarget);
+     if (target == NULL) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     linkBefore(pList, target, createDNode(newStudent));
+ }
+ 
+ /**
+  * @brief Insert a new student after a student with a specific name
+  * @param pList Pointer to the doubly linked list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert after
+  */
+ void dInsertAfterStudent(DLinkedList *pList, Student newStudent, const char *nameTarget) {
+     DNode *target = findByName(pList, nameTarget);
+     if (target == NULL) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     linkBefore(pList, target->pNextNode, createDNode(newStudent));
+ }
+ 
+ /**
+  * @brief Insert a new student at a specific position
+  * @param pList Pointer to the doubly linked list
+  * @param newStudent New student data
+  * @param position Position to insert the student (1-based index)
+  */
+ void dInsertSpecificPosition(DLinkedList *pList, Student newStudent, int position) {
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     if (position == pList->nodeCount + 1) {
+         dAddTail(pList, createDNode(newStudent)); /* Position right after the tail */
+         return;
+     }
+     DNode *current = nodeAt(pList, position);
+     if (current == NULL) {
+         printf("Position out of range!\n");
+         return;
+     }
+     linkBefore(pList, current, createDNode(newStudent));
+ }
+ 
+ /**
+  * @brief Delete the head of the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  */
+ void dDeleteHead(DLinkedList *pList) {
+     if (pList->pHead == NULL) {
+         printf("List is empty!\n");
+         return;
+     }
+     removeNode(pList, pList->pHead);
+ }
+ 
+ /**
+  * @brief Delete the tail of the doubly linked list in O(1)
+  * @param pList Pointer to the doubly linked list
+  */
+ void dDeleteLast(DLinkedList *pList) {
+     if (pList->pTail == NULL) {
+         printf("List is empty!\n");
+         return;
+     }
+     removeNode(pList, pList->pTail); /* No walk: tail knows its predecessor */
+ }
+ 
+ /**
+  * @brief Delete the node before a student with a specific name
+  * @param pList Pointer to the doubly linked list
+  * @param nameTarget Name of the target student
+  */
+ void dDeleteBeforeStudent(DLinkedList *pList, const char *nameTarget) {
+     if (pList->pHead == NULL || pList->pHead->pNextNode == NULL) {
+         printf("Cannot delete before the first student!\n");
+         return;
+     }
+     DNode *target = findByName(pList, nameTarget);
+     if (target == NULL) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     if (target->pPrevNode != NULL) {
+         removeNode(pList, target->pPrevNode);
+     }
+ }
+ 
+ /**
+  * @brief Delete the node after a student with a specific name
+  * @param pList Pointer to the doubly linked list
+  * @param nameTarget Name of the target student
+  */
+ void dDeleteAfterStudent(DLinkedList *pList, const char *nameTarget) {
+     DNode *target = findByName(pList, nameTarget);
+     if (target == NULL) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     if (target->pNextNode == NULL) {
+         printf("No student after %s!\n", nameTarget);
+         return;
+     }
+     removeNode(pList, target->pNextNode);
+ }
+ 
+ /**
+  * @brief Delete a student at a specific position
+  * @param pList Pointer to the doubly linked list
+  * @param position Position of the student to delete (1-based index)
+  */
+ void dDeleteSpecificPosition(DLinkedList *pList, int position) {
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     DNode *current = nodeAt(pList, position);
+     if (current == NULL) {
+         printf("Position out of range!\n");
+         return;
+     }
+     removeNode(pList, current);
+ }
+ 
+ /**
+  * @brief Edit the student at the head of the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  * @param newStudent New student data
+  */
+ void dEditHead(DLinkedList *pList, Student newStudent) {
+     if (pList->pHead == NULL) {
+         printf("List is empty!\n");
+         return;
+     }
+     pList->pHead->dataStudent = newStudent; /* Update head data */
+ }
+ 
+ /**
+  * @brief Edit the student at the tail of the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  * @param newStudent New student data
+  */
+ void dEditLast(DLinkedList *pList, Student newStudent) {
+     if (pList->pTail == NULL) {
+         printf("List is empty!\n");
+         return;
+     }
+     pList->pTail->dataStudent = newStudent; /* Update tail data */
+ }
+ 
+ /**
+  * @brief Edit a student at a specific position
+  * @param pList Pointer to the doubly linked list
+  * @param position Position of the student to edit (1-based index)
+  * @param newStudent New student data
+  */
+ void dEditSpecificPosition(DLinkedList *pList, int position, Student newStudent) {
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     DNode *current = nodeAt(pList, position);
+     if (current == NULL) {
+         printf("Position out of range!\n");
+         return;
+     }
+     current->dataStudent = newStudent; /* Update data at position */
+ }
+ 
+ /**
+  * @brief Free all nodes in the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  */
+ void dFreeLinkedList(DLinkedList *pList) {
+     DNode *current = pList->pHead;
+     while (current != NULL) {
+         DNode *temp = current;
+         current = current->pNextNode;
+         free(temp); /* Free each node */
+     }
+     pList->pHead = NULL;
+     pList->pTail = NULL;
+     pList->nodeCount = 0;
+ }
+ 
+ /**
+  * @brief Merge two sorted chains linked through pNextNode
+  * @param pLeft Chain holding the earlier elements (wins ties)
+  * @param pRight Chain holding the later elements
+  * @param keys Sort keys
+  * @param nkeys Number of keys
+  * @return Head of the merged chain
+  */
+ static DNode* mergeChains(DNode *pLeft, DNode *pRight, const SortKey *keys, int nkeys) {
+     DNode dummy;
+     DNode *pLast = &dummy;
+     while (pLeft != NULL && pRight != NULL) {
+         if (compareStudentsByKeys(&pRight->dataStudent, &pLeft->dataStudent, keys, nkeys) < 0) {
+             pLast->pNextNode = pRight;
+             pRight = pRight->pNextNode;
+         } else {
+             pLast->pNextNode = pLeft;
+             pLeft = pLeft->pNextNode;
+         }
+         pLast = pLast->pNextNode;
+     }
+     pLast->pNextNode = (pLeft != NULL) ? pLeft : pRight;
+     return dummy.pNextNode;
+ }
+ 
+ /**
+  * @brief Stable sort of the doubly linked list by several keys in priority order
+  * @param pList Pointer to the doubly linked list
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
+  * @note  Bottom-up merge sort on pNextNode, then one pass restores pPrevNode
+  */
+ void dSortList(DLinkedList *pList, const SortKey *keys, int nkeys) {
+     DNode *bins[64] = { NULL };
+     DNode *current = pList->pHead;
+     DNode *result = NULL;
+     DNode *prev = NULL;
+     int i;
+ 
+     if (keys == NULL || nkeys < 1) {
+         printf("Invalid sort keys!\n");
+         return;
+     }
+     for (i = 0; i < nkeys; i++) {
+         if ((unsigned int)keys[i].field > SORT_FIELD_GPA || (unsigned int)keys[i].direction > SORT_DESCENDING) {
+             printf("Invalid sort keys!\n");
+             return;
+         }
+     }
+     if (current == NULL || current->pNextNode == NULL) return;
+     while (current != NULL) {
+         DNode *run = current;
+         current = current->pNextNode;
+         run->pNextNode = NULL;
+         for (i = 0; i < 63 && bins[i] != NULL; i++) {
+             run = mergeChains(bins[i], run, keys, nkeys);
+             bins[i] = NULL;
+         }
+         bins[i] = (bins[i] != NULL) ? mergeChains(bins[i], run, keys, nkeys) : run;
+     }
+     for (i = 0; i < 64; i++) {
+         if (bins[i] != NULL) {
+             result = (result != NULL) ? mergeChains(bins[i], result, keys, nkeys) : bins[i];
+         }
+     }
+     pList->pHead = result;
+     for (current = result; current != NULL; current = current->pNextNode) {
+         current->pPrevNode = prev; /* Restore back links */
+         prev = current;
+     }
+     pList->pTail = prev;
+ }
+ 
+ /**
+  * @brief Sort the doubly linked list by one field
+  * @param pList Pointer to the doubly linked list
+  * @param field Field to sort by
+  * @param direction Sort direction
+  */
+ static void dSortBySingleKey(DLinkedList *pList, SortField_TypeDef field, SortDirection_TypeDef direction) {
+     SortKey key = { field, direction };
+     dSortList(pList, &key, 1);
+ }
+ 
+ /**
+  * @brief Sort the doubly linked list by name in ascending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByNameAsc(DLinkedList *pList) {
+     dSortBySingleKey(pList, SORT_FIELD_NAME, SORT_ASCENDING);
+ }
+ 
+ /**
+  * @brief Sort the doubly linked list by name in descending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByNameDesc(DLinkedList *pList) {
+     dSortBySingleKey(pList, SORT_FIELD_NAME, SORT_DESCENDING);
+ }
+ 
+ /**
+  * @brief Sort the doubly linked list by GPA in ascending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByScoreAsc(DLinkedList *pList) {
+     dSortBySingleKey(pList, SORT_FIELD_GPA, SORT_ASCENDING);
+ }
+ 
+ /**
+  * @brief Sort the doubly linked list by GPA in descending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByScoreDesc(DLinkedList *pList) {
+     dSortBySingleKey(pList, SORT_FIELD_GPA, SORT_DESCENDING);
+ }
+ 
+ /**
+  * @brief Sort the doubly linked list by age in ascending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByAgeAsc(DLinkedList *pList) {
+     dSortBySingleKey(pList, SORT_FIELD_AGE, SORT_ASCENDING);
+ }
+ 
+ /**
+  * @brief Sort the doubly linked list by age in descending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByAgeDesc(DLinkedList *pList) {
+     dSortBySingleKey(pList, SORT_FIELD_AGE, SORT_DESCENDING);
+ }
+ 
+ /**
+  * @brief Count the number of nodes in the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  * @return Number of nodes in the list
+  */
+ int dCountNodes(DLinkedList *pList) {
+     return pList->nodeCount;
+ }
@@ -0,0 +1,217 @@
+/**
+ ******************************************************************************
+ * @file    dlinkedlist.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for doubly linked list management
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef DLINKEDLIST_H
+ #define DLINKEDLIST_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include "linkedlist.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Doubly linked list node structure
+  */
+ typedef struct DNode {
+     Student dataStudent;    /* Student data stored in the node */
+     struct DNode *pNextNode; /* Pointer to the next node */
+     struct DNode *pPrevNode; /* Pointer to the previous node */
+ } DNode;
+ 
+ /**
+  * @brief Doubly linked list structure
+  */
+ typedef struct DLinkedList {
+     DNode *pHead;          /* Pointer to the head of the list */
+     DNode *pTail;          /* Pointer to the tail of the list */
+     int nodeCount;         /* Number of nodes in the list */
+ } DLinkedList;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Initialize the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  */
+ void initDLinkedList(DLinkedList *pList);
+ 
+ /**
+  * @brief Create a new doubly linked node with the given student data
+  * @param student Student data to be stored in the node
+  * @return Pointer to the newly created node
+  */
+ DNode* createDNode(Student student);
+ 
+ /**
+  * @brief Add a node to the head of the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  * @param pNewNode Pointer to the new node
+  */
+ void dAddHead(DLinkedList *pList, DNode *pNewNode);
+ 
+ /**
+  * @brief Add a node to the tail of the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  * @param pNewNode Pointer to the new node
+  */
+ void dAddTail(DLinkedList *pList, DNode *pNewNode);
+ 
+ /**
+  * @brief Insert a new student before a student with a specific name
+  * @param pList Pointer to the doubly linked list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert before
+  */
+ void dInsertBeforeStudent(DLinkedList *pList, Student newStudent, const char *nameTarget);
+ 
+ /**
+  * @brief Insert a new student after a student with a specific name
+  * @param pList Pointer to the doubly linked list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert after
+  */
+ void dInsertAfterStudent(DLinkedList *pList, Student newStudent, const char *nameTarget);
+ 
+ /**
+  * @brief Insert a new student at a specific position
+  * @param pList Pointer to the doubly linked list
+  * @param newStudent New student data
+  * @param position Position to insert the student (1-based index)
+  */
+ void dInsertSpecificPosition(DLinkedList *pList, Student newStudent, int position);
+ 
+ /**
+  * @brief Delete the head of the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  */
+ void dDeleteHead(DLinkedList *pList);
+ 
+ /**
+  * @brief Delete the tail of the doubly linked list in O(1)
+  * @param pList Pointer to the doubly linked list
+  */
+ void dDeleteLast(DLinkedList *pList);
+ 
+ /**
+  * @brief Delete the node before a student with a specific name
+  * @param pList Pointer to the doubly linked list
+  * @param nameTarget Name of the target student
+  * @note  Unlinking is O(1) once the target is found
+  */
+ void dDeleteBeforeStudent(DLinkedList *pList, const char *nameTarget);
+ 
+ /**
+  * @brief Delete the node after a student with a specific name
+  * @param pList Pointer to the doubly linked list
+  * @param nameTarget Name of the target student
+  */
+ void dDeleteAfterStudent(DLinkedList *pList, const char *nameTarget);
+ 
+ /**
+  * @brief Delete a student at a specific position
+  * @param pList Pointer to the doubly linked list
+  * @param position Position of the student to delete (1-based index)
+  */
+ void dDeleteSpecificPosition(DLinkedList *pList, int position);
+ 
+ /**
+  * @brief Edit the student at the head of the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  * @param newStudent New student data
+  */
+ void dEditHead(DLinkedList *pList, Student newStudent);
+ 
+ /**
+  * @brief Edit the student at the tail of the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  * @param newStudent New student data
+  */
+ void dEditLast(DLinkedList *pList, Student newStudent);
+ 
+ /**
+  * @brief Edit a student at a specific position
+  * @param pList Pointer to the doubly linked list
+  * @param position Position of the student to edit (1-based index)
+  * @param newStudent New student data
+  */
+ void dEditSpecificPosition(DLinkedList *pList, int position, Student newStudent);
+ 
+ /**
+  * @brief Free all nodes in the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  */
+ void dFreeLinkedList(DLinkedList *pList);
+ 
+ /**
+  * @brief Stable sort of the doubly linked list by several keys in priority order
+  * @param pList Pointer to the doubly linked list
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
+  */
+ void dSortList(DLinkedList *pList, const SortKey *keys, int nkeys);
+ 
+ /**
+  * @brief Sort the doubly linked list by name in ascending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByNameAsc(DLinkedList *pList);
+ 
+ /**
+  * @brief Sort the doubly linked list by name in descending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByNameDesc(DLinkedList *pList);
+ 
+ /**
+  * @brief Sort the doubly linked list by GPA in ascending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByScoreAsc(DLinkedList *pList);
+ 
+ /**
+  * @brief Sort the doubly linked list by GPA in descending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByScoreDesc(DLinkedList *pList);
+ 
+ /**
+  * @brief Sort the doubly linked list by age in ascending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByAgeAsc(DLinkedList *pList);
+ 
+ /**
+  * @brief Sort the doubly linked list by age in descending order
+  * @param pList Pointer to the doubly linked list
+  */
+ void dSortByAgeDesc(DLinkedList *pList);
+ 
+ /**
+  * @brief Count the number of nodes in the doubly linked list
+  * @param pList Pointer to the doubly linked list
+  * @return Number of nodes in the list
+  * @note  O(1): returns the count kept up to date by every link and unlink
+  */
+ int dCountNodes(DLinkedList *pList);
+ 
+ #endif /* DLINKEDLIST_H */
@@ -0,0 +1,211 @@
+/**
+ ******************************************************************************
+ * @file    epochreclaim.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of epoch-based memory reclamation
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include <stdio.h>
+ #include <stdlib.h>
+ #include "EpochReclaim.h"
+ 
+ /****************************************************************************** 
+  * VARIABLES
+  ******************************************************************************/
+ static atomic_ulong nextDomainId = 1;                 /* Source of EpochDomain ids */
+ static _Thread_local unsigned long cachedDomainId;    /* Domain of the record this thread used last */
+ static _Thread_local EpochRecord *pCachedRecord;      /* That record */
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Initialize an epoch domain
+  * @param pDomain Pointer to the domain
+  * @param pFree Callback that frees a retired object
+  */
+ void initEpochDomain(EpochDomain *pDomain, EpochFree_TypeDef pFree) {
+     atomic_init(&pDomain->globalEpoch, 0);
+     atomic_init(&pDomain->pRecords, NULL);
+     pDomain->pFree = pFree;
+     pDomain->id = atomic_fetch_add(&nextDomainId, 1);
+ }
+ 
+ /**
+  * @brief Free a limbo list
+  * @param pDomain Domain whose callback frees the objects
+  * @param pEntry First object of the list
+  */
+ static void freeLimbo(EpochDomain *pDomain, EpochEntry *pEntry) {
+     while (pEntry != NULL) {
+         EpochEntry *pNext = pEntry->pNext;
+         pDomain->pFree(pEntry);
+         pEntry = pNext;
+     }
+ }
+ 
+ /**
+  * @brief Free every retired object and every record of a domain
+  * @param pDomain Pointer to the domain
+  */
+ void destroyEpochDomain(EpochDomain *pDomain) {
+     EpochRecord *pRecord = atomic_load(&pDomain->pRecords);
+     while (pRecord != NULL) {
+         EpochRecord *pNext = pRecord->pNext;
+         for (int i = 0; i < EBR_LIMBO_LISTS; i++) freeLimbo(pDomain, pRecord->limbo[i]);
+         free(pRecord);
+         pRecord = pNext;
+     }
+     atomic_store(&pDomain->pRecords, NULL);
+ }
+ 
+ /**
+  * @brief Try to claim a record for this thread
+  * @param pRecord Record to claim
+  * @return 1 if claimed, 0 if another thread holds it
+  */
+ static int takeRecord(EpochRecord *pRecord) {
+     int expected = 0;
+     return atomic_compare_exchange_strong_explicit(&pRecord->inUse, &expected, 1,
+                                                    memory_order_acquire, memory_order_relaxed);
+ }
+ 
+ /**
+  * @brief Claim a free record of the domain, creating one if all are held
+  * @param pDomain Pointer to the domain
+  * @return Claimed record
+  */
+ static EpochRecord* acquireRecord(EpochDomain *pDomain) {
+     EpochRecord *pRecord;
+     if (cachedDomainId == pDomain->id && takeRecord(pCachedRecord)) return pCachedRecord;
+     for (pRecord = atomic_load_explicit(&pDomain->pRecords, memory_order_acquire); pRecord != NULL;
+          pRecord = pRecord->pNext) {
+         if (takeRecord(pRecord)) break;
+     }
+     if (pRecord == NULL) {
+         pRecord = (EpochRecord*)calloc(1, sizeof(EpochRecord));
+         if (pRecord == NULL) {
+             printf("Memory allocation failed!\n");
+             exit(1);
+         }
+         atomic_init(&pRecord->state, 0);
+         atomic_init(&pRecord->inUse, 1);
+         pRecord->pDomain = pDomain;
+         pRecord->pNext = atomic_load_explicit(&pDomain->pRecords, memory_order_relaxed);
+         while (!atomic_compare_exchange_weak_explicit(&pDomain->pRecords, &pRecord->pNext, pRecord,
+                                                       memory_order_release, memory_order_relaxed));
+     }
+     cachedDomainId = pDomain->id;
+     pCachedRecord = pRecord;
+     return pRecord;
+ }
+ 
+ /**
+  * @brief Advance the global epoch if every thread inside has seen it
+  * @param pDomain Pointer to the domain
+  * @return The global epoch afterwards
+  */
+ static unsigned long long tryAdvanceEpoch(EpochDomain *pDomain) {
+     unsigned long long epoch = atomic_load(&pDomain->globalEpoch);
+     atomic_thread_fence(memory_order_seq_cst); /* Our unlinks come before reading who is inside */
+     for (EpochRecord *pRecord = atomic_load_explicit(&pDomain->pRecords, memory_order_acquire); pRecord != NULL;
+          pRecord = pRecord->pNext) {
+         unsigned long long state = atomic_load(&pRecord->state);
+         if ((state & 1ULL) != 0 && (state >> 1) != epoch) return epoch; /* Someone is still in an older epoch */
+     }
+     if (atomic_compare_exchange_strong(&pDomain->globalEpoch, &epoch, epoch + 1)) return epoch + 1;
+     return epoch; /* Another thread advanced it; epoch holds the new value */
+ }
+ 
+ /**
+  * @brief Free the limbo lists of a record that are two epochs old
+  * @param pRecord Record held by this thread
+  * @param epoch Current global epoch
+  */
+ static void freeSafeLimbo(EpochRecord *pRecord, unsigned long long epoch) {
+     for (int i = 0; i < EBR_LIMBO_LISTS; i++) {
+         if (pRecord->limbo[i] != NULL && epoch - pRecord->limboEpoch[i] >= 2) {
+             freeLimbo(pRecord->pDomain, pRecord->limbo[i]);
+             pRecord->limbo[i] = NULL;
+         }
+     }
+ }
+ 
+ /**
+  * @brief Enter the domain before reading shared objects
+  * @param pDomain Pointer to the domain
+  * @return Record to pass to ebrRetire and ebrExit
+  */
+ EpochRecord* ebrEnter(EpochDomain *pDomain) {
+     EpochRecord *pRecord = acquireRecord(pDomain);
+     unsigned long long epoch;
+     do {
+         epoch = atomic_load(&pDomain->globalEpoch);
+         atomic_store_explicit(&pRecord->state, (epoch << 1) | 1ULL, memory_order_relaxed);
+         atomic_thread_fence(memory_order_seq_cst); /* Announce before reading any shared pointer */
+     } while (atomic_load(&pDomain->globalEpoch) != epoch); /* Moved meanwhile: announce the new one */
+     return pRecord;
+ }
+ 
+ /**
+  * @brief Leave the domain; pointers read inside must not be used afterwards
+  * @param pRecord Record returned by ebrEnter
+  */
+ void ebrExit(EpochRecord *pRecord) {
+     atomic_store_explicit(&pRecord->state, 0, memory_order_release);
+     atomic_store_explicit(&pRecord->inUse, 0, memory_order_release);
+ }
+ 
+ /**
+  * @brief Hand over an object that is no longer reachable, to be freed later
+  * @param pRecord Record returned by ebrEnter, still inside
+  * @param pEntry Link embedded in the unlinked object
+  */
+ void ebrRetire(EpochRecord *pRecord, EpochEntry *pEntry) {
+     unsigned long long epoch;
+     int slot;
+     atomic_thread_fence(memory_order_seq_cst); /* The unlink is visible before the epoch is read */
+     epoch = atomic_load(&pRecord->pDomain->globalEpoch); /* Anyone who saw the object is at this epoch or older */
+     slot = (int)(epoch % EBR_LIMBO_LISTS);
+     if (pRecord->limbo[slot] != NULL && pRecord->limboEpoch[slot] != epoch) {
+         freeLimbo(pRecord->pDomain, pRecord->limbo[slot]); /* Same slot, three or more epochs ago */
+         pRecord->limbo[slot] = NULL;
+     }
+     pEntry->pNext = pRecord->limbo[slot];
+     pRecord->limbo[slot] = pEntry;
+     pRecord->limboEpoch[slot] = epoch;
+     if (++pRecord->retiresSinceScan >= EBR_RETIRE_SCAN) {
+         pRecord->retiresSinceScan = 0;
+         freeSafeLimbo(pRecord, tryAdvanceEpoch(pRecord->pDomain));
+     }
+ }
+ 
+ /**
+  * @brief Advance the epoch as far as the threads inside allow and free what is safe
+  * @param pDomain Pointer to the domain
+  */
+ void ebrCollect(EpochDomain *pDomain) {
+     unsigned long long epoch = atomic_load(&pDomain->globalEpoch);
+     for (int i = 0; i < EBR_LIMBO_LISTS - 1; i++) epoch = tryAdvanceEpoch(pDomain); /* Two steps make all current lists safe */
+     for (EpochRecord *pRecord = atomic_load_explicit(&pDomain->pRecords, memory_order_acquire); pRecord != NULL;
+          pRecord = pRecord->pNext) {
+         if (!takeRecord(pRecord)) continue;
+         freeSafeLimbo(pRecord, epoch);
+         atomic_store_explicit(&pRecord->inUse, 0, memory_order_release);
+     }
+ }
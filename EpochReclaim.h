@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+ * @file    epochreclaim.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for epoch-based memory reclamation
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef EPOCHRECLAIM_H
+ #define EPOCHRECLAIM_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include <stdatomic.h>
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define EBR_LIMBO_LISTS                     (3)    /* Current epoch, previous one, and the one being freed */
+ #define EBR_RETIRE_SCAN                     (64)   /* Retires between attempts to advance the epoch */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Link embedded in every object that can be retired
+  */
+ typedef struct EpochEntry {
+     struct EpochEntry *pNext;           /* Next object in the same limbo list */
+ } EpochEntry;
+ 
+ /**
+  * @brief Callback that returns a retired object to its allocator
+  * @param pEntry Link embedded in the object
+  */
+ typedef void (*EpochFree_TypeDef)(EpochEntry *pEntry);
+ 
+ /**
+  * @brief Announcement slot and limbo lists, used by one thread at a time
+  */
+ typedef struct EpochRecord {
+     atomic_ullong state;                /* (epoch << 1) | 1 while inside, 0 outside */
+     atomic_int inUse;                   /* 1 from ebrEnter to ebrExit */
+     struct EpochDomain *pDomain;        /* Domain the record belongs to */
+     struct EpochRecord *pNext;          /* Next record of the domain, fixed once published */
+     EpochEntry *limbo[EBR_LIMBO_LISTS]; /* Objects retired in each epoch, indexed by epoch % 3 */
+     unsigned long long limboEpoch[EBR_LIMBO_LISTS]; /* Epoch the objects of each list were retired in */
+     int retiresSinceScan;               /* Retires since the last advance attempt */
+ } EpochRecord;
+ 
+ /**
+  * @brief Set of objects protected by one global epoch
+  * @note  Threads wrap every access to shared objects in ebrEnter/ebrExit.
+  *        An object unlinked by a writer is retired with the epoch of the
+  *        moment, and handed to pFree once the global epoch is two ahead:
+  *        by then every thread that could have reached it has exited.
+  *        The epoch only advances when every thread inside has seen the
+  *        current one, so a stalled reader delays frees but never breaks them.
+  */
+ typedef struct EpochDomain {
+     atomic_ullong globalEpoch;          /* Current epoch */
+     _Atomic(EpochRecord*) pRecords;     /* Records created so far, never removed */
+     EpochFree_TypeDef pFree;            /* Frees one retired object */
+     unsigned long id;                   /* Unique id, lets threads cache their record */
+ } EpochDomain;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Initialize an epoch domain
+  * @param pDomain Pointer to the domain
+  * @param pFree Callback that frees a retired object
+  */
+ void initEpochDomain(EpochDomain *pDomain, EpochFree_TypeDef pFree);
+ 
+ /**
+  * @brief Free every retired object and every record of a domain
+  * @param pDomain Pointer to the domain
+  * @note  No thread may be inside the domain during or after this call
+  */
+ void destroyEpochDomain(EpochDomain *pDomain);
+ 
+ /**
+  * @brief Enter the domain before reading shared objects
+  * @param pDomain Pointer to the domain
+  * @return Record to pass to ebrRetire and ebrExit
+  * @note  Reuses the record this thread had last time when it is free, so
+  *        the usual cost is one compare-and-swap and one fence
+  */
+ EpochRecord* ebrEnter(EpochDomain *pDomain);
+ 
+ /**
+  * @brief Leave the domain; pointers read inside must not be used afterwards
+  * @param pRecord Record returned by ebrEnter
+  */
+ void ebrExit(EpochRecord *pRecord);
+ 
+ /**
+  * @brief Hand over an object that is no longer reachable, to be freed later
+  * @param pRecord Record returned by ebrEnter, still inside
+  * @param pEntry Link embedded in the unlinked object
+  */
+ void ebrRetire(EpochRecord *pRecord, EpochEntry *pEntry);
+ 
+ /**
+  * @brief Advance the epoch as far as the threads inside allow and free what is safe
+  * @param pDomain Pointer to the domain
+  * @note  Never waits; records held by other threads are left for them
+  */
+ void ebrCollect(EpochDomain *pDomain);
+ 
+ #endif /* EPOCHRECLAIM_H */
@@ -20,11 +20,630 @@
 /****************************************************************************** 
  * INCLUDES
  ******************************************************************************/
+ #include <stdint.h>
+ #include <limits.h>
+ #include <assert.h>
  #include "linkedlist.h"
+ #include "NameIndex.h"
+ #include "NameSearch.h"
+ #include "PositionIndex.h"
+ #include "StudentQuery.h"
+ #include "WorkerThreads.h"
 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ /** @defgroup Node pool sizing
+  * @{
+  */
+ #define POOL_FIRST_SLAB_NODES               (1024U)
+ #define POOL_MAX_SLAB_NODES                 (1048576U)
+ /**
+  * @}
+  */
+ 
+ /** @defgroup Binary roster I/O
+  * @{
+  */
+ #define ROSTER_CHUNK_RECORDS                (4096U)  /* Records per read/write; even, so chunks are 4-byte multiples */
+ /**
+  * @}
+  */
+ 
+ /** @defgroup Order labels
+  * @{
+  */
+ #define LABEL_BASE                          ((uint64_t)1 << 30) /* Labels start here after a full relabel, room for head inserts */
+ #define LABEL_SPAN                          ((uint64_t)1 << 31) /* Labels spread over this much after a full relabel */
+ #define LABEL_LIMIT                         ((uint64_t)1 << 32) /* One past the highest label */
+ #define LABEL_WINDOW_MAX                    (1024U) /* Most nodes relabelled locally before relabelling the list */
+ #define LABEL_MIN_GAP                       (32U)   /* Smallest gap a local relabel may leave */
+ /**
+  * @}
+  */
+ 
+ /** @defgroup Packed sort keys
+  * @{
+  */
+ #define SORT_KEY_WORDS                      (4U)  /* Name uses 2 words, age and GPA 1 each */
+ #define SORT_NAME_PREFIX                    (16U) /* Name bytes packed into the key words */
+ #define SORT_SMALL_RUN                      (16U) /* Runs sorted by insertion before merging */
+ #define SORT_RADIX_BUCKETS                  (256U) /* One byte of key per radix pass */
+ #define SORT_PARALLEL_MIN_NODES             (32768U) /* Fewest nodes worth giving a sort thread */
+ /**
+  * @}
+  */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Student comparison callback used by the merge sort engine
+  */
+ typedef int (*StudentCompare_TypeDef)(const Student *pA, const Student *pB);
+ 
+ /**
+  * @brief Node with its sort keys packed into order-preserving integers
+  */
+ typedef struct SortRecord {
+     uint64_t key[SORT_KEY_WORDS];  /* Packed keys, compared word by word */
+     Node *pNode;                   /* Node the keys were taken from */
+ } SortRecord;
+ 
+ /**
+  * @brief Layout of the packed keys for one sortList call
+  */
+ typedef struct SortPlan {
+     int nWords;                    /* Number of key words in use */
+     int nameTailWord;              /* Word after which long names compare their tail, -1 if none */
+     int nameDescending;            /* Direction of the name key */
+ } SortPlan;
+ 
+ /**
+  * @brief Contiguous part of the records sorted by one thread
+  */
+ typedef struct SortSegment {
+     SortRecord *pRecords;          /* Records of the part, nodes already filled in */
+     SortRecord *pBuffer;           /* Scratch space of the same length */
+     size_t count;                  /* Number of records */
+     const SortKey *keys;           /* Deduplicated sort keys */
+     int nkeys;                     /* Number of keys */
+     const SortPlan *pPlan;         /* Key layout */
+     SortRecord *pSorted;           /* Set by the thread: pRecords or pBuffer */
+ } SortSegment;
+ 
+ /****************************************************************************** 
+  * VARIABLES
+  ******************************************************************************/
+ static NodePool defaultPool = { NULL, NULL, NULL, 0, POOL_FIRST_SLAB_NODES }; /* Pool behind createNode */
+ static int sortThreadCount = 1;     /* Threads used by sortList, 0 for one per hardware thread */
+ 
  /****************************************************************************** 
   * CODE
   ******************************************************************************/
+ /**
+  * @brief Initialize an empty node pool
+  * @param pPool Pointer to the node pool
+  */
+ void initNodePool(NodePool *pPool) {
+     pPool->pSlabs = NULL;
+     pPool->pFreeList = NULL;
+     pPool->pBump = NULL;
+     pPool->bumpRemaining = 0;
+     pPool->nextSlabSize = POOL_FIRST_SLAB_NODES;
+ }
+ 
+ /**
+  * @brief Take a node from the pool, growing it by one slab if needed
+  * @param pPool Pointer to the node pool
+  * @return Pointer to an uninitialized node, or NULL if out of memory
+  */
+ Node* poolAllocNode(NodePool *pPool) {
+     Node *pNode = pPool->pFreeList;
+     if (pNode != NULL) {
+         pPool->pFreeList = pNode->pNextNode; /* Reuse a released node first */
+         return pNode;
+     }
+     if (pPool->bumpRemaining == 0) {
+         size_t capacity = pPool->nextSlabSize;
+         NodeSlab *pSlab = (NodeSlab*)malloc(sizeof(NodeSlab) + capacity * sizeof(Node));
+         if (pSlab == NULL) {
+             return NULL;
+         }
+         pSlab->capacity = capacity;
+         pSlab->pNextSlab = pPool->pSlabs;
+         pPool->pSlabs = pSlab;
+         pPool->pBump = pSlab->nodes;
+         pPool->bumpRemaining = capacity;
+         if (pPool->nextSlabSize < POOL_MAX_SLAB_NODES) {
+             pPool->nextSlabSize *= 2; /* Grow slabs geometrically */
+         }
+     }
+     pNode = pPool->pBump++;
+     pPool->bumpRemaining--;
+     return pNode;
+ }
+ 
+ /**
+  * @brief Take a contiguous block of nodes from the pool
+  * @param pPool Pointer to the node pool
+  * @param count Number of nodes, at least 1
+  * @return Pointer to the first of count uninitialized nodes, or NULL if out of memory
+  * @note  Blocks larger than what is left in the current slab get a slab of
+  *        their own, so the rest of the current slab is not wasted
+  */
+ Node* poolAllocBlock(NodePool *pPool, size_t count) {
+     Node *pBlock;
+     if (count > pPool->bumpRemaining) {
+         NodeSlab *pSlab;
+         if (count > (SIZE_MAX - sizeof(NodeSlab)) / sizeof(Node)) {
+             return NULL;
+         }
+         pSlab = (NodeSlab*)malloc(sizeof(NodeSlab) + count * sizeof(Node));
+         if (pSlab == NULL) {
+             return NULL;
+         }
+         pSlab->capacity = count;
+         pSlab->pNextSlab = pPool->pSlabs; /* The bump slab stays current */
+         pPool->pSlabs = pSlab;
+         return pSlab->nodes;
+     }
+     pBlock = pPool->pBump;
+     pPool->pBump += count;
+     pPool->bumpRemaining -= count;
+     return pBlock;
+ }
+ 
+ /**
+  * @brief Return a single node to the pool
+  * @param pPool Pointer to the node pool
+  * @param pNode Node to release
+  */
+ void poolFreeNode(NodePool *pPool, Node *pNode) {
+     pNode->pNextNode = pPool->pFreeList;
+     pPool->pFreeList = pNode;
+ }
+ 
+ /**
+  * @brief Return a whole linked chain of nodes to the pool in O(1)
+  * @param pPool Pointer to the node pool
+  * @param pFirst First node of the chain
+  * @param pLast Last node of the chain
+  */
+ void poolFreeChain(NodePool *pPool, Node *pFirst, Node *pLast) {
+     if (pFirst == NULL) return;
+     pLast->pNextNode = pPool->pFreeList; /* The chain already links itself */
+     pPool->pFreeList = pFirst;
+ }
+ 
+ /**
+  * @brief Release every slab of the pool back to the system
+  * @param pPool Pointer to the node pool
+  */
+ void destroyNodePool(NodePool *pPool) {
+     NodeSlab *pSlab = pPool->pSlabs;
+     while (pSlab != NULL) {
+         NodeSlab *pNext = pSlab->pNextSlab;
+         free(pSlab);
+         pSlab = pNext;
+     }
+     initNodePool(pPool);
+ }
+ 
+ /**
+  * @brief Get the pool used by createNode and the delete functions
+  * @return Pointer to the default node pool
+  */
+ NodePool* getDefaultNodePool(void) {
+     return &defaultPool;
+ }
+ 
+ /**
+  * @brief Record a newly linked node in the name index, dropping the index on failure
+  * @param pList Pointer to the linked list
+  * @param pNode Node that was linked
+  * @param pPrev Node before it, NULL if it is the head
+  */
+ static void indexLinkedNode(LinkedList *pList, Node *pNode, Node *pPrev) {
+     if (!nameIndexAdd(pList->pNameIndex, pNode, pPrev)) {
+         disableNameIndex(pList); /* Out of memory: fall back to scans */
+         return;
+     }
+     if (pNode->pNextNode != NULL) {
+         nameIndexSetPrev(pList->pNameIndex, pNode->pNextNode, pNode);
+     }
+ }
+ 
+ /**
+  * @brief Check whether the nodes must carry increasing order labels
+  * @param pList Pointer to the linked list
+  * @return Non-zero while a sorted index breaks ties by them
+  */
+ static int labelsNeeded(const LinkedList *pList) {
+     return pList->pRangeIndex != NULL || pList->pPrefixIndex != NULL;
+ }
+ 
+ /**
+  * @brief Give a run of nodes evenly spaced labels
+  * @param pFirst First node of the run
+  * @param count Nodes in the run
+  * @param lo Label before the run; the first node gets lo + step
+  * @param step Gap between two labels
+  */
+ static void spreadLabels(Node *pFirst, size_t count, uint64_t lo, uint64_t step) {
+     for (size_t i = 1; i <= count; i++, pFirst = pFirst->pNextNode) pFirst->orderLabel = (uint32_t)(lo + i * step);
+ }
+ 
+ /**
+  * @brief Get the gap between labels after a full relabel
+  * @param pList Pointer to the linked list
+  * @return Gap, at least 1
+  */
+ static uint64_t labelSpacing(const LinkedList *pList) {
+     uint64_t spacing = LABEL_SPAN / ((uint64_t)pList->nodeCount + 1);
+     return (spacing != 0) ? spacing : 1;
+ }
+ 
+ /**
+  * @brief Label the whole list again, evenly over the middle of the label range
+  * @param pList Pointer to the linked list
+  * @note  Labels keep their order, so the sorted indexes stay valid
+  */
+ static void relabelList(LinkedList *pList) {
+     if (pList->pHead != NULL) spreadLabels(pList->pHead, (size_t)pList->nodeCount, LABEL_BASE, labelSpacing(pList));
+ }
+ 
+ /**
+  * @brief Label nodes just linked between two labelled ones
+  * @param pList Pointer to the linked list, nodeCount already counting them
+  * @param pPrev Node before them, NULL at the head
+  * @param pFirst First new node
+  * @param count Number of new nodes
+  * @note  They share the gap between their neighbours. When it is too
+  *        narrow, the new nodes and a growing run after them are spread
+  *        over the gap up to the end of the run; past LABEL_WINDOW_MAX
+  *        nodes the whole list is relabelled. Steps at either end are
+  *        capped at the full-relabel spacing so runs of appends or head
+  *        inserts use the range up gradually.
+  */
+ static void labelNewNodes(LinkedList *pList, Node *pPrev, Node *pFirst, size_t count) {
+     uint64_t lo = (pPrev != NULL) ? pPrev->orderLabel : 0;
+     uint64_t spacing = labelSpacing(pList);
+     uint64_t hi;
+     uint64_t step;
+     Node *pNext = pFirst;
+     size_t window = count;
+     if (!labelsNeeded(pList)) return;
+     for (size_t i = 0; i < count; i++) pNext = pNext->pNextNode;
+     if (pPrev == NULL && pNext == NULL) { /* The list was empty */
+         relabelList(pList);
+         return;
+     }
+     hi = (pNext != NULL) ? pNext->orderLabel : LABEL_LIMIT;
+     step = (hi - lo) / (count + 1);
+     if ((pPrev == NULL || pNext == NULL) && step > spacing) step = spacing;
+     if (step >= 1) {
+         spreadLabels(pFirst, count, (pPrev == NULL) ? hi - (count + 1) * step : lo, step); /* Head inserts end just below hi */
+         return;
+     }
+     while (pNext != NULL && window < LABEL_WINDOW_MAX) {
+         for (size_t grow = window; grow > 0 && pNext != NULL; grow--, window++) pNext = pNext->pNextNode;
+         hi = (pNext != NULL) ? pNext->orderLabel : LABEL_LIMIT;
+         step = (hi - lo) / (window + 1);
+         if (pNext == NULL && step > spacing) step = spacing;
+         if (step >= LABEL_MIN_GAP) {
+             spreadLabels(pFirst, window, lo, step);
+             return;
+         }
+     }
+     relabelList(pList);
+ }
+ 
+ /**
+  * @brief Enter a labelled node in the sorted indexes
+  * @param pList Pointer to the linked list
+  * @param pNode Node, with its final data
+  */
+ static void indexSortedNode(LinkedList *pList, Node *pNode) {
+     if (pList->pRangeIndex != NULL) rangeIndexAdd(pList->pRangeIndex, pNode); /* Marks itself dirty on failure */
+     if (pList->pPrefixIndex != NULL) prefixIndexAdd(pList->pPrefixIndex, pNode);
+ }
+ 
+ /**
+  * @brief Take a node out of the sorted indexes
+  * @param pList Pointer to the linked list
+  * @param pNode Node, still holding the data it was entered with
+  */
+ static void unindexSortedNode(LinkedList *pList, const Node *pNode) {
+     if (pList->pRangeIndex != NULL) rangeIndexRemove(pList->pRangeIndex, pNode);
+     if (pList->pPrefixIndex != NULL) prefixIndexRemove(pList->pPrefixIndex, pNode);
+ }
+ 
+ /**
+  * @brief Relabel the list and rebuild the sorted indexes after it was reordered
+  * @param pList Pointer to the linked list
+  */
+ static void rebuildSortedIndexes(LinkedList *pList) {
+     if (!labelsNeeded(pList)) return;
+     relabelList(pList);
+     if (pList->pRangeIndex != NULL) {
+         rangeIndexRebuild(pList->pRangeIndex, pList->pHead, (size_t)pList->nodeCount); /* Retried by the next query on failure */
+     }
+     if (pList->pPrefixIndex != NULL) {
+         prefixIndexRebuild(pList->pPrefixIndex, pList->pHead, (size_t)pList->nodeCount); /* Retried by the next search on failure */
+     }
+ }
+ 
+ /**
+  * @brief Keep the positional index in step with a structural change
+  * @param pList Pointer to the linked list
+  * @param pNode Node linked or being unlinked
+  * @param position Its position, 0 if unknown
+  * @param linked 1 for an insertion, 0 for a removal
+  */
+ static void trackPosition(LinkedList *pList, Node *pNode, int position, int linked) {
+     PositionIndex *pIndex = pList->pPosIndex;
+     if (pIndex == NULL || pIndex->dirty) return;
+     if (position < 1) {
+         pIndex->dirty = 1; /* Rebuilt on the next positional access */
+     } else if (linked) {
+         if (!positionIndexInsert(pIndex, pNode, position, pList->nodeCount)) pIndex->dirty = 1;
+     } else {
+         positionIndexRemove(pIndex, pNode, position);
+     }
+ }
+ 
+ /**
+  * @brief Link a node after another node and keep head, tail and indexes in sync
+  * @param pList Pointer to the linked list
+  * @param pPrev Node to link after, NULL to link at the head
+  * @param pNode Node to link
+  * @param position Position the node lands on, 0 if unknown
+  */
+ static void linkAfter(LinkedList *pList, Node *pPrev, Node *pNode, int position) {
+     if (pPrev == NULL) {
+         pNode->pNextNode = pList->pHead;
+         pList->pHead = pNode;
+     } else {
+         pNode->pNextNode = pPrev->pNextNode;
+         pPrev->pNextNode = pNode;
+     }
+     pList->changeCount++;
+     if (pNode->pNextNode == NULL) {
+         pList->pTail = pNode; /* Linked at the end */
+     } else {
+         pList->reshapeCount++; /* Anything but an append moves later rows */
+     }
+     trackPosition(pList, pNode, position, 1);
+     pList->nodeCount++;
+     if (pList->pNameIndex != NULL) {
+         indexLinkedNode(pList, pNode, pPrev);
+     }
+     labelNewNodes(pList, pPrev, pNode, 1);
+     indexSortedNode(pList, pNode);
+ }
+ 
+ /**
+  * @brief Unlink the node after another node and keep head, tail and indexes in sync
+  * @param pList Pointer to the linked list
+  * @param pPrev Node before the one to unlink, NULL to unlink the head
+  * @param position Position of the node to unlink, 0 if unknown
+  * @return The unlinked node, still owned by the caller
+  */
+ static Node* unlinkAfter(LinkedList *pList, Node *pPrev, int position) {
+     Node *pNode = (pPrev == NULL) ? pList->pHead : pPrev->pNextNode;
+     if (pPrev == NULL) {
+         pList->pHead = pNode->pNextNode;
+     } else {
+         pPrev->pNextNode = pNode->pNextNode;
+     }
+     if (pNode == pList->pTail) {
+         pList->pTail = pPrev; /* Unlinked the last node */
+     }
+     pList->changeCount++;
+     pList->reshapeCount++;
+     trackPosition(pList, pNode, position, 0);
+     pList->nodeCount--;
+     if (pList->pNameIndex != NULL) {
+         nameIndexRemove(pList->pNameIndex, pNode);
+         if (pNode->pNextNode != NULL) {
+             nameIndexSetPrev(pList->pNameIndex, pNode->pNextNode, pPrev);
+         }
+     }
+     unindexSortedNode(pList, pNode);
+     return pNode;
+ }
+ 
+ /**
+  * @brief Find the node just before a position, through the positional index if enabled
+  * @param pList Pointer to the linked list
+  * @param position Position (1-based), at most nodeCount + 1
+  * @return Node at position - 1, or NULL when position is 1
+  */
+ static Node* nodeBefore(LinkedList *pList, int position) {
+     PositionIndex *pIndex = pList->pPosIndex;
+     Node *prev = NULL;
+     if (pIndex != NULL && (!pIndex->dirty || positionIndexRebuild(pIndex, pList->pHead))) {
+         return positionIndexNodeBefore(pIndex, pList->pHead, position);
+     }
+     for (int i = 1; i < position; i++) {
+         prev = (prev == NULL) ? pList->pHead : prev->pNextNode;
+     }
+     return prev;
+ }
+ 
+ /**
+  * @brief Find the first node with a name and its predecessor
+  * @param pList Pointer to the linked list
+  * @param name Name to look for
+  * @param ppPrev Receives the node before the match, NULL if the match is the head
+  * @return Matching node, or NULL if not found
+  */
+ static Node* findNodeByName(LinkedList *pList, const char *name, Node **ppPrev) {
+     NameIndexEntry *pEntry = NULL;
+     Node *prev = NULL;
+     if (pList->pNameIndex != NULL) {
+         pEntry = nameIndexFind(pList->pNameIndex, name);
+         if (pEntry == NULL) return NULL;
+         if (pEntry->pNode != NULL) {
+             *ppPrev = pEntry->pPrev; /* O(1) hit */
+             return pEntry->pNode;
+         }
+     }
+     for (Node *current = pList->pHead; current != NULL; current = current->pNextNode) {
+         if (strcmp(current->dataStudent.nameStudent, name) == 0) {
+             if (pEntry != NULL && pEntry->count == 1) {
+                 nameIndexResolve(pEntry, current, prev); /* Name is unique again */
+             }
+             *ppPrev = prev;
+             return current;
+         }
+         prev = current;
+     }
+     return NULL;
+ }
+ 
+ /**
+  * @brief Overwrite a node's student data, re-keying the name indexes if the name changes
+  * @param pList Pointer to the linked list
+  * @param pNode Node to update
+  * @param pPrev Node before it, NULL if it is the head
+  * @param newStudent New student data
+  */
+ static void replaceStudent(LinkedList *pList, Node *pNode, Node *pPrev, Student newStudent) {
+     int renamed = strcmp(pNode->dataStudent.nameStudent, newStudent.nameStudent) != 0;
+     pList->changeCount++;
+     pList->reshapeCount++;
+     unindexSortedNode(pList, pNode); /* Found by its old keys */
+     if (renamed && pList->pNameIndex != NULL) {
+         nameIndexRemove(pList->pNameIndex, pNode);
+         pNode->dataStudent = newStudent;
+         if (!nameIndexAdd(pList->pNameIndex, pNode, pPrev)) {
+             disableNameIndex(pList);
+         }
+     } else {
+         pNode->dataStudent = newStudent;
+     }
+     indexSortedNode(pList, pNode);
+ }
+ 
+ /**
+  * @brief Re-enter every node in the name index after the chain was relinked
+  * @param pList Pointer to the linked list
+  */
+ static void rebuildNameIndex(LinkedList *pList) {
+     Node *prev = NULL;
+     if (pList->pNameIndex == NULL) return;
+     nameIndexClear(pList->pNameIndex);
+     for (Node *current = pList->pHead; current != NULL; current = current->pNextNode) {
+         if (!nameIndexAdd(pList->pNameIndex, current, prev)) {
+             disableNameIndex(pList);
+             return;
+         }
+         prev = current;
+     }
+ }
+ 
+ /**
+  * @brief Bring indexes and change counters up to date after the chain was reordered
+  * @param pList Pointer to the linked list
+  */
+ static void noteReorder(LinkedList *pList) {
+     pList->changeCount++;
+     pList->reshapeCount++;
+     rebuildNameIndex(pList); /* Predecessors changed everywhere */
+     if (pList->pPosIndex != NULL) pList->pPosIndex->dirty = 1; /* Towers point at old positions */
+     assert(checkListConsistency(pList)); /* Debug builds: the relinked chain matches count and tail */
+ }
+ 
+ /**
+  * @brief Sort the list again by its maintained order, if it has one
+  * @param pList Pointer to the linked list
+  */
+ static void restoreOrder(LinkedList *pList) {
+     SortKey keys[LIST_MAX_ORDER_KEYS];
+     int nkeys = pList->orderKeyCount;
+     if (nkeys == 0) return;
+     memcpy(keys, pList->orderKeys, sizeof(keys));
+     pList->orderKeyCount = 0; /* Let sortListParallel past its already-sorted shortcut */
+     sortListParallel(pList, keys, nkeys, sortThreadCount);
+     pList->orderKeyCount = nkeys;
+ }
+ 
+ /**
+  * @brief Link a node on its sorted place, after the students that sort equal to it
+  * @param pList Pointer to the linked list, with a maintained order
+  * @param pNode Node to link
+  */
+ static void linkOrdered(LinkedList *pList, Node *pNode) {
+     PositionIndex *pIndex = pList->pPosIndex;
+     const SortKey *keys = pList->orderKeys;
+     int nkeys = pList->orderKeyCount;
+     Node *prev = NULL;
+     int position = 0;
+     if (pList->pTail == NULL || compareStudentsByKeys(&pList->pTail->dataStudent, &pNode->dataStudent, keys, nkeys) <= 0) {
+         linkAfter(pList, pList->pTail, pNode, pList->nodeCount + 1); /* Sorts last: a plain append */
+         return;
+     }
+     if (pIndex != NULL && (!pIndex->dirty || positionIndexRebuild(pIndex, pList->pHead))) {
+         prev = positionIndexUpperBound(pIndex, pList->pHead, &pNode->dataStudent, keys, nkeys, &position);
+     } else {
+         for (Node *next = pList->pHead; compareStudentsByKeys(&next->dataStudent, &pNode->dataStudent, keys, nkeys) <= 0;
+              next = next->pNextNode) {
+             prev = next; /* Stops before the tail, which sorts after pNode */
+             position++;
+         }
+     }
+     linkAfter(pList, prev, pNode, position + 1);
+ }
+ 
+ /**
+  * @brief Move an edited node if its new data broke the maintained order
+  * @param pList Pointer to the linked list
+  * @param pNode Edited node
+  * @param pPrev Node before it, NULL if it is the head
+  * @param position Its position (1-based)
+  */
+ static void keepOrderAfterEdit(LinkedList *pList, Node *pNode, Node *pPrev, int position) {
+     const SortKey *keys = pList->orderKeys;
+     int nkeys = pList->orderKeyCount;
+     if (nkeys == 0) return;
+     if ((pPrev == NULL || compareStudentsByKeys(&pPrev->dataStudent, &pNode->dataStudent, keys, nkeys) <= 0)
+         && (pNode->pNextNode == NULL
+             || compareStudentsByKeys(&pNode->dataStudent, &pNode->pNextNode->dataStudent, keys, nkeys) <= 0)) {
+         return; /* Still between its neighbours */
+     }
+     linkOrdered(pList, unlinkAfter(pList, pPrev, position));
+ }
+ 
+ /**
+  * @brief Bring indexes and change counters up to date after the chain was relinked directly
+  * @param pList Pointer to the linked list, with pHead, pTail and nodeCount already set
+  */
+ void noteListRelinked(LinkedList *pList) {
+     noteReorder(pList);
+     if (labelsNeeded(pList)) relabelList(pList); /* Kept nodes keep their order, so the sorted indexes stay valid */
+     restoreOrder(pList);
+ }
+ 
+ /**
+  * @brief Take a node out of the sorted indexes before changing or freeing it directly
+  * @param pList Pointer to the linked list
+  * @param pNode Node of the list, not yet changed
+  */
+ void unindexListNode(LinkedList *pList, const Node *pNode) {
+     unindexSortedNode(pList, pNode);
+ }
+ 
+ /**
+  * @brief Enter a node in the sorted indexes after noteListRelinked
+  * @param pList Pointer to the linked list
+  * @param pNode Node linked or changed directly
+  */
+ void indexListNode(LinkedList *pList, Node *pNode) {
+     indexSortedNode(pList, pNode);
+ }
+ 
  /**
   * @brief Initialize the linked list
   * @param pList Pointer to the linked list
@@ -32,6 +651,14 @@
  void initLinkedList(LinkedList *pList) {
      pList->pHead = NULL; /* Set head to NULL */
      pList->pTail = NULL; /* Set tail to NULL */
+     pList->nodeCount = 0; /* Start empty */
+     pList->changeCount = 0;
+     pList->reshapeCount = 0;
+     pList->pNameIndex = NULL; /* No name index until enabled */
+     pList->pPosIndex = NULL;  /* No positional index until enabled */
+     pList->pRangeIndex = NULL; /* No range index until enabled */
+     pList->pPrefixIndex = NULL; /* No prefix index until enabled */
+     pList->orderKeyCount = 0; /* Inserts go where they are asked */
  }
  
  /**
@@ -40,7 +667,7 @@
   * @return Pointer to the newly created node
   */
  Node* createNode(Student student) {
-     Node *newNode = (Node*)malloc(sizeof(Node));
+     Node *newNode = poolAllocNode(&defaultPool);
      if (newNode == NULL) {
          printf("Memory allocation failed!\n");
          exit(1);
@@ -56,284 +683,1025 @@
   * @param pNewNode Pointer to the new node
   */
  void addHead(LinkedList *pList, Node *pNewNode) {
-     if (pList->pHead == NULL) {
-         pList->pHead = pNewNode; /* If list is empty, set head and tail */
-         pList->pTail = pNewNode;
-     } else {
-         pNewNode->pNextNode = pList->pHead; /* Link new node to current head */
-         pList->pHead = pNewNode;            /* Update head to new node */
+     if (pList->orderKeyCount > 0) {
+         linkOrdered(pList, pNewNode);
+         return;
+     }
+     linkAfter(pList, NULL, pNewNode, 1); /* Link new node before current head */
+ }
+ 
+ /**
+  * @brief Add a node to the tail of the linked list
+  * @param pList Pointer to the linked list
+  * @param pNewNode Pointer to the new node
+  */
+ void addTail(LinkedList *pList, Node *pNewNode) {
+     if (pList->orderKeyCount > 0) {
+         linkOrdered(pList, pNewNode);
+         return;
+     }
+     linkAfter(pList, pList->pTail, pNewNode, pList->nodeCount + 1); /* Link current tail to new node */
+ }
+ 
+ /**
+  * @brief Insert a new student before a student with a specific name
+  * @param pList Pointer to the linked list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert before
+  */
+ void insertBeforeStudent(LinkedList *pList, Student newStudent, const char *nameTarget) {
+     Node *prev = NULL;
+     if (findNodeByName(pList, nameTarget, &prev) == NULL) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     if (pList->orderKeyCount > 0) {
+         linkOrdered(pList, createNode(newStudent));
+         return;
+     }
+     linkAfter(pList, prev, createNode(newStudent), 0); /* Link new node before target */
+ }
+ 
+ /**
+  * @brief Insert a new student after a student with a specific name
+  * @param pList Pointer to the linked list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert after
+  */
+ void insertAfterStudent(LinkedList *pList, Student newStudent, const char *nameTarget) {
+     Node *prev = NULL;
+     Node *current = findNodeByName(pList, nameTarget, &prev);
+     if (current == NULL) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     if (pList->orderKeyCount > 0) {
+         linkOrdered(pList, createNode(newStudent));
+         return;
+     }
+     linkAfter(pList, current, createNode(newStudent), 0); /* Link new node after target */
+ }
+ 
+ /**
+  * @brief Insert a new student at a specific position
+  * @param pList Pointer to the linked list
+  * @param newStudent New student data
+  * @param position Position to insert the student (1-based index)
+  */
+ void insertSpecificPosition(LinkedList *pList, Student newStudent, int position) {
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     if (position > pList->nodeCount + 1) {
+         printf("Position out of range!\n");
+         return;
+     }
+     if (pList->orderKeyCount > 0) {
+         linkOrdered(pList, createNode(newStudent)); /* The sorted place wins over a valid position */
+         return;
+     }
+     Node *newNode = createNode(newStudent);
+     linkAfter(pList, nodeBefore(pList, position), newNode, position); /* Link new node at position */
+ }
+ 
+ /**
+  * @brief Delete the head of the linked list
+  * @param pList Pointer to the linked list
+  */
+ void deleteHead(LinkedList *pList) {
+     if (pList->pHead == NULL) {
+         printf("List is empty!\n");
+         return;
+     }
+     poolFreeNode(&defaultPool, unlinkAfter(pList, NULL, 1)); /* Return deleted node to the pool */
+ }
+ 
+ /**
+  * @brief Delete the tail of the linked list
+  * @param pList Pointer to the linked list
+  */
+ void deleteLast(LinkedList *pList) {
+     if (pList->pHead == NULL) {
+         printf("List is empty!\n");
+         return;
+     }
+     Node *prev = nodeBefore(pList, pList->nodeCount); /* O(log n) with the positional index */
+     poolFreeNode(&defaultPool, unlinkAfter(pList, prev, pList->nodeCount)); /* Free tail node */
+ }
+ 
+ /**
+  * @brief Delete the node before a student with a specific name
+  * @param pList Pointer to the linked list
+  * @param nameTarget Name of the target student
+  */
+ void deleteBeforeStudent(LinkedList *pList, const char *nameTarget) {
+     if (pList->pHead == NULL || pList->pHead->pNextNode == NULL) {
+         printf("Cannot delete before the first student!\n");
+         return;
+     }
+     Node *prev = NULL;
+     if (findNodeByName(pList, nameTarget, &prev) == NULL) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     if (prev == NULL) return; /* Target is the head: nothing before it */
+     Node *prevPrev = NULL;
+     if (prev != pList->pHead && findNodeByName(pList, prev->dataStudent.nameStudent, &prevPrev) != prev) {
+         /* Duplicate name ahead of prev: locate its predecessor by walking */
+         for (prevPrev = pList->pHead; prevPrev->pNextNode != prev; prevPrev = prevPrev->pNextNode);
+     }
+     poolFreeNode(&defaultPool, unlinkAfter(pList, prevPrev, 0)); /* Skip node before target */
+ }
+ 
+ /**
+  * @brief Delete the node after a student with a specific name
+  * @param pList Pointer to the linked list
+  * @param nameTarget Name of the target student
+  */
+ void deleteAfterStudent(LinkedList *pList, const char *nameTarget) {
+     Node *prev = NULL;
+     Node *current = findNodeByName(pList, nameTarget, &prev);
+     if (current == NULL) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     if (current->pNextNode == NULL) {
+         printf("No student after %s!\n", nameTarget);
+         return;
+     }
+     poolFreeNode(&defaultPool, unlinkAfter(pList, current, 0)); /* Skip node after target */
+ }
+ 
+ /**
+  * @brief Delete a student at a specific position
+  * @param pList Pointer to the linked list
+  * @param position Position of the student to delete (1-based index)
+  */
+ void deleteSpecificPosition(LinkedList *pList, int position) {
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     if (position == 1) {
+         deleteHead(pList); /* Delete head if position is 1 */
+         return;
+     }
+     if (position > pList->nodeCount) {
+         printf("Position out of range!\n");
+         return;
+     }
+     Node *prev = nodeBefore(pList, position);
+     poolFreeNode(&defaultPool, unlinkAfter(pList, prev, position)); /* Skip node at position */
+ }
+ 
+ /**
+  * @brief Edit the student at the head of the linked list
+  * @param pList Pointer to the linked list
+  * @param newStudent New student data
+  */
+ void editHead(LinkedList *pList, Student newStudent) {
+     if (pList->pHead == NULL) {
+         printf("List is empty!\n");
+         return;
+     }
+     replaceStudent(pList, pList->pHead, NULL, newStudent); /* Update head data */
+     keepOrderAfterEdit(pList, pList->pHead, NULL, 1);
+ }
+ 
+ /**
+  * @brief Edit the student at the tail of the linked list
+  * @param pList Pointer to the linked list
+  * @param newStudent New student data
+  */
+ void editLast(LinkedList *pList, Student newStudent) {
+     if (pList->pTail == NULL) {
+         printf("List is empty!\n");
+         return;
+     }
+     Node *prev = NULL;
+     if (pList->pNameIndex != NULL && pList->pTail != pList->pHead
+         && findNodeByName(pList, pList->pTail->dataStudent.nameStudent, &prev) != pList->pTail) {
+         prev = nodeBefore(pList, pList->nodeCount);
+     }
+     replaceStudent(pList, pList->pTail, prev, newStudent); /* Update tail data */
+     if (pList->orderKeyCount > 0) {
+         keepOrderAfterEdit(pList, pList->pTail, nodeBefore(pList, pList->nodeCount), pList->nodeCount);
+     }
+ }
+ 
+ /**
+  * @brief Edit a student at a specific position
+  * @param pList Pointer to the linked list
+  * @param position Position of the student to edit (1-based index)
+  * @param newStudent New student data
+  */
+ void editSpecificPosition(LinkedList *pList, int position, Student newStudent) {
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     if (position > pList->nodeCount) {
+         printf("Position out of range!\n");
+         return;
+     }
+     Node *prev = nodeBefore(pList, position);
+     Node *current = (prev == NULL) ? pList->pHead : prev->pNextNode;
+     replaceStudent(pList, current, prev, newStudent); /* Update data at position */
+     keepOrderAfterEdit(pList, current, prev, position);
+ }
+ 
+ /**
+  * @brief Record a chain just linked at the tail in the counters and indexes
+  * @param pList Pointer to the linked list, with pTail and nodeCount already updated
+  * @param pFirst First node of the chain
+  * @param pPrev Node before it, NULL if the list was empty
+  */
+ static void noteAppendedChain(LinkedList *pList, Node *pFirst, Node *pPrev) {
+     pList->changeCount++; /* Appends leave reshapeCount alone, like addTail */
+     if (pList->pPosIndex != NULL) pList->pPosIndex->dirty = 1; /* One rebuild instead of one insert per node */
+     if (labelsNeeded(pList)) {
+         size_t count = 0;
+         for (Node *current = pFirst; current != NULL; current = current->pNextNode) count++;
+         labelNewNodes(pList, pPrev, pFirst, count);
+         for (Node *current = pFirst; current != NULL; current = current->pNextNode) indexSortedNode(pList, current);
+     }
+     for (Node *current = pFirst; current != NULL && pList->pNameIndex != NULL; current = current->pNextNode) {
+         if (!nameIndexAdd(pList->pNameIndex, current, pPrev)) disableNameIndex(pList); /* Fall back to scans */
+         pPrev = current;
+     }
+ }
+ 
+ /**
+  * @brief Empty a list whose nodes were moved to another one
+  * @param pList Pointer to the linked list
+  */
+ static void detachAllNodes(LinkedList *pList) {
+     pList->pHead = NULL;
+     pList->pTail = NULL;
+     pList->nodeCount = 0;
+     noteReorder(pList); /* Clears the name index */
+     rebuildSortedIndexes(pList); /* Empties them */
+ }
+ 
+ /**
+  * @brief Append students from an array, linked in one contiguous block of nodes
+  * @param pList Pointer to the linked list
+  * @param pStudents Students in list order
+  * @param count Number of students
+  * @return 1 on success, 0 if out of memory (a message is printed and the list is unchanged)
+  */
+ int buildListFromArray(LinkedList *pList, const Student *pStudents, size_t count) {
+     Node *pBlock = NULL;
+     Node *pPrev = pList->pTail;
+     if (count == 0) return 1;
+     if (count <= (size_t)(INT_MAX - pList->nodeCount)) pBlock = poolAllocBlock(&defaultPool, count);
+     if (pBlock == NULL) {
+         printf("Memory allocation failed!\n");
+         return 0;
+     }
+     for (size_t i = 0; i < count; i++) {
+         pBlock[i].dataStudent = pStudents[i];
+         pBlock[i].pNextNode = &pBlock[i + 1];
+     }
+     pBlock[count - 1].pNextNode = NULL;
+     if (pPrev == NULL) {
+         pList->pHead = pBlock;
+     } else {
+         pPrev->pNextNode = pBlock;
+     }
+     pList->pTail = &pBlock[count - 1];
+     pList->nodeCount += (int)count;
+     noteAppendedChain(pList, pBlock, pPrev);
+     restoreOrder(pList);
+     return 1;
+ }
+ 
+ /**
+  * @brief Move every node of a list to the tail of another one
+  * @param pDst List receiving the nodes
+  * @param pSrc List giving the nodes, empty afterwards
+  */
+ void appendList(LinkedList *pDst, LinkedList *pSrc) {
+     Node *pPrev = pDst->pTail;
+     if (pDst == pSrc || pSrc->pHead == NULL) return;
+     if (pPrev == NULL) {
+         pDst->pHead = pSrc->pHead;
+     } else {
+         pPrev->pNextNode = pSrc->pHead;
+     }
+     pDst->pTail = pSrc->pTail;
+     pDst->nodeCount += pSrc->nodeCount;
+     noteAppendedChain(pDst, pSrc->pHead, pPrev);
+     detachAllNodes(pSrc);
+     restoreOrder(pDst);
+ }
+ 
+ /**
+  * @brief Move every node of a list into another one at a specific position
+  * @param pDst List receiving the nodes
+  * @param pSrc List giving the nodes, empty afterwards
+  * @param position Position the first moved node lands on (1-based index)
+  */
+ void spliceList(LinkedList *pDst, LinkedList *pSrc, int position) {
+     Node *pPrev;
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     if (position > pDst->nodeCount + 1) {
+         printf("Position out of range!\n");
+         return;
+     }
+     if (pDst == pSrc || pSrc->pHead == NULL) return;
+     if (position == pDst->nodeCount + 1) {
+         appendList(pDst, pSrc); /* Keeps reshapeCount, snapshots only copy the new rows */
+         return;
+     }
+     pPrev = nodeBefore(pDst, position);
+     if (pPrev == NULL) {
+         pSrc->pTail->pNextNode = pDst->pHead;
+         pDst->pHead = pSrc->pHead;
+     } else {
+         pSrc->pTail->pNextNode = pPrev->pNextNode;
+         pPrev->pNextNode = pSrc->pHead;
+     }
+     pDst->nodeCount += pSrc->nodeCount;
+     noteReorder(pDst);
+     if (labelsNeeded(pDst)) {
+         labelNewNodes(pDst, pPrev, pSrc->pHead, (size_t)pSrc->nodeCount);
+         for (Node *current = pSrc->pHead; current != pSrc->pTail->pNextNode; current = current->pNextNode) {
+             indexSortedNode(pDst, current);
+         }
+     }
+     detachAllNodes(pSrc);
+     restoreOrder(pDst);
+ }
+ 
+ /**
+  * @brief Move the nodes from a specific position to the end to the tail of another list
+  * @param pList List to cut
+  * @param position Position of the first node to move (1-based index)
+  * @param pRest List receiving the nodes
+  */
+ void splitListAt(LinkedList *pList, int position, LinkedList *pRest) {
+     LinkedList moved;
+     Node *pPrev;
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     if (position > pList->nodeCount + 1) {
+         printf("Position out of range!\n");
+         return;
+     }
+     if (pList == pRest || position == pList->nodeCount + 1) return;
+     pPrev = nodeBefore(pList, position);
+     initLinkedList(&moved);
+     moved.pHead = (pPrev == NULL) ? pList->pHead : pPrev->pNextNode;
+     if (labelsNeeded(pList)) {
+         for (Node *current = moved.pHead; current != NULL; current = current->pNextNode) unindexSortedNode(pList, current);
+     }
+     moved.pTail = pList->pTail;
+     moved.nodeCount = pList->nodeCount - position + 1;
+     if (pPrev == NULL) {
+         pList->pHead = NULL;
+     } else {
+         pPrev->pNextNode = NULL;
+     }
+     pList->pTail = pPrev;
+     pList->nodeCount = position - 1;
+     noteReorder(pList);
+     appendList(pRest, &moved);
+ }
+ 
+ /**
+  * @brief Build a hash index on nameStudent and keep it updated on every change
+  * @param pList Pointer to the linked list
+  * @return 1 if the index is enabled, 0 if it could not be allocated
+  */
+ int enableNameIndex(LinkedList *pList) {
+     if (pList->pNameIndex != NULL) return 1;
+     pList->pNameIndex = createNameIndex((size_t)countNodes(pList));
+     if (pList->pNameIndex == NULL) return 0;
+     rebuildNameIndex(pList);
+     return pList->pNameIndex != NULL;
+ }
+ 
+ /**
+  * @brief Drop the name index and go back to linear name scans
+  * @param pList Pointer to the linked list
+  */
+ void disableNameIndex(LinkedList *pList) {
+     destroyNameIndex(pList->pNameIndex);
+     pList->pNameIndex = NULL;
+ }
+ 
+ /**
+  * @brief Build a skip-list index over the chain for O(log n) positional access
+  * @param pList Pointer to the linked list
+  * @return 1 if the index is enabled, 0 if it could not be allocated
+  */
+ int enablePositionIndex(LinkedList *pList) {
+     if (pList->pPosIndex != NULL) return 1;
+     pList->pPosIndex = createPositionIndex();
+     if (pList->pPosIndex == NULL) return 0;
+     positionIndexRebuild(pList->pPosIndex, pList->pHead); /* Retried on use if this fails */
+     return 1;
+ }
+ 
+ /**
+  * @brief Drop the positional index and go back to walking from the head
+  * @param pList Pointer to the linked list
+  */
+ void disablePositionIndex(LinkedList *pList) {
+     destroyPositionIndex(pList->pPosIndex);
+     pList->pPosIndex = NULL;
+ }
+ 
+ /**
+  * @brief Keep node pointers sorted by age and by GPA for rangeByAge and rangeByGPA
+  * @param pList Pointer to the linked list
+  * @return 1 if the index is enabled, 0 if it could not be allocated
+  */
+ int enableRangeIndex(LinkedList *pList) {
+     if (pList->pRangeIndex != NULL) return 1;
+     pList->pRangeIndex = createRangeIndex();
+     if (pList->pRangeIndex == NULL) return 0;
+     relabelList(pList);
+     rangeIndexRebuild(pList->pRangeIndex, pList->pHead, (size_t)pList->nodeCount); /* Retried by the first query on failure */
+     return 1;
+ }
+ 
+ /**
+  * @brief Drop the range index and go back to scanning the list
+  * @param pList Pointer to the linked list
+  */
+ void disableRangeIndex(LinkedList *pList) {
+     destroyRangeIndex(pList->pRangeIndex);
+     pList->pRangeIndex = NULL;
+ }
+ 
+ /**
+  * @brief Keep node pointers sorted by name, ignoring case, for searchStudentsByName
+  * @param pList Pointer to the linked list
+  * @return 1 if the index is enabled, 0 if it could not be allocated
+  */
+ int enablePrefixIndex(LinkedList *pList) {
+     if (pList->pPrefixIndex != NULL) return 1;
+     pList->pPrefixIndex = createPrefixIndex();
+     if (pList->pPrefixIndex == NULL) return 0;
+     relabelList(pList);
+     prefixIndexRebuild(pList->pPrefixIndex, pList->pHead, (size_t)pList->nodeCount); /* Retried by the first search on failure */
+     return 1;
+ }
+ 
+ /**
+  * @brief Drop the prefix index and go back to scanning the list
+  * @param pList Pointer to the linked list
+  */
+ void disablePrefixIndex(LinkedList *pList) {
+     destroyPrefixIndex(pList->pPrefixIndex);
+     pList->pPrefixIndex = NULL;
+ }
+ 
+ /**
+  * @brief Find the first student with a specific name
+  * @param pList Pointer to the linked list
+  * @param name Name to look for
+  * @return Node of the student, or NULL if no student has this name
+  */
+ Node* findStudentByName(LinkedList *pList, const char *name) {
+     Node *prev = NULL;
+     return findNodeByName(pList, name, &prev);
+ }
+ 
+ /**
+  * @brief Find the student at a specific position
+  * @param pList Pointer to the linked list
+  * @param position Position (1-based index)
+  * @return Node at that position, or NULL if it is out of range
+  */
+ Node* findStudentAt(LinkedList *pList, int position) {
+     Node *prev;
+     if (position < 1 || position > pList->nodeCount) return NULL;
+     prev = nodeBefore(pList, position);
+     return (prev == NULL) ? pList->pHead : prev->pNextNode;
+ }
+ 
+ /**
+  * @brief Comparators for each sort field and direction (negative: A first)
+  */
+ static int compareNameAsc(const Student *pA, const Student *pB) {
+     return strcmp(pA->nameStudent, pB->nameStudent);
+ }
+ 
+ static int compareNameDesc(const Student *pA, const Student *pB) {
+     return strcmp(pB->nameStudent, pA->nameStudent);
+ }
+ 
+ static int compareScoreAsc(const Student *pA, const Student *pB) {
+     return (pA->GPA > pB->GPA) - (pA->GPA < pB->GPA);
+ }
+ 
+ static int compareScoreDesc(const Student *pA, const Student *pB) {
+     return (pA->GPA < pB->GPA) - (pA->GPA > pB->GPA);
+ }
+ 
+ static int compareAgeAsc(const Student *pA, const Student *pB) {
+     return (pA->ageStudent > pB->ageStudent) - (pA->ageStudent < pB->ageStudent);
+ }
+ 
+ static int compareAgeDesc(const Student *pA, const Student *pB) {
+     return (pA->ageStudent < pB->ageStudent) - (pA->ageStudent > pB->ageStudent);
+ }
+ 
+ /**
+  * @brief Merge two sorted NULL-terminated chains by relinking nodes
+  * @param pLeft Chain holding the earlier elements (wins ties, keeps sort stable)
+  * @param pRight Chain holding the later elements
+  * @param compare Comparison callback
+  * @return Head of the merged chain
+  */
+ static Node* mergeChains(Node *pLeft, Node *pRight, StudentCompare_TypeDef compare) {
+     Node dummy;
+     Node *pLast = &dummy;
+     while (pLeft != NULL && pRight != NULL) {
+         if (compare(&pRight->dataStudent, &pLeft->dataStudent) < 0) {
+             pLast->pNextNode = pRight;
+             pRight = pRight->pNextNode;
+         } else {
+             pLast->pNextNode = pLeft;
+             pLeft = pLeft->pNextNode;
+         }
+         pLast = pLast->pNextNode;
+     }
+     pLast->pNextNode = (pLeft != NULL) ? pLeft : pRight;
+     return dummy.pNextNode;
+ }
+ 
+ /**
+  * @brief Stable bottom-up merge sort that relinks pNextNode pointers
+  * @param pList Pointer to the linked list
+  * @param compare Comparison callback
+  * @note  Runs in O(n log n) using bins[i] holding a sorted run of 2^i nodes
+  */
+ static void mergeSortList(LinkedList *pList, StudentCompare_TypeDef compare) {
+     Node *bins[64] = { NULL };
+     Node *current = pList->pHead;
+     Node *result = NULL;
+     int i;
+ 
+     if (current == NULL || current->pNextNode == NULL) return;
+     while (current != NULL) {
+         Node *run = current;
+         current = current->pNextNode;
+         run->pNextNode = NULL;
+         for (i = 0; i < 63 && bins[i] != NULL; i++) {
+             run = mergeChains(bins[i], run, compare); /* Older run goes on the left */
+             bins[i] = NULL;
+         }
+         bins[i] = (bins[i] != NULL) ? mergeChains(bins[i], run, compare) : run;
+     }
+     for (i = 0; i < 64; i++) {
+         if (bins[i] != NULL) {
+             result = (result != NULL) ? mergeChains(bins[i], result, compare) : bins[i];
+         }
+     }
+     pList->pHead = result;
+     for (current = result; current->pNextNode != NULL; current = current->pNextNode);
+     pList->pTail = current; /* Re-establish tail after relinking */
+ }
+ 
+ /**
+  * @brief Map a float to an unsigned integer with the same ordering
+  * @param value Float to transform
+  * @return Order-preserving bit pattern
+  */
+ static uint32_t orderedFloatBits(float value) {
+     uint32_t bits;
+     if (value == 0.0f) value = 0.0f; /* Fold -0.0 onto 0.0, they compare equal */
+     memcpy(&bits, &value, sizeof(bits));
+     return (bits & 0x80000000U) ? ~bits : (bits | 0x80000000U);
+ }
+ 
+ /**
+  * @brief Pack a record's keys according to the sort keys
+  * @param pRecord Record to fill
+  * @param keys Deduplicated sort keys
+  * @param nkeys Number of keys
+  */
+ static void packSortRecord(SortRecord *pRecord, const SortKey *keys, int nkeys) {
+     const Student *pStudent = &pRecord->pNode->dataStudent;
+     int word = 0;
+     for (int k = 0; k < nkeys; k++) {
+         uint64_t invert = (keys[k].direction == SORT_DESCENDING) ? UINT64_MAX : 0;
+         if (keys[k].field == SORT_FIELD_NAME) {
+             uint64_t high = 0, low = 0;
+             int ended = 0;
+             for (unsigned int i = 0; i < SORT_NAME_PREFIX; i++) {
+                 unsigned char c = ended ? 0 : (unsigned char)pStudent->nameStudent[i];
+                 if (c == '\0') ended = 1; /* Pad after the terminator like strcmp sees it */
+                 if (i < 8) high = (high << 8) | c;
+                 else low = (low << 8) | c;
+             }
+             pRecord->key[word++] = high ^ invert;
+             pRecord->key[word++] = low ^ invert;
+         } else if (keys[k].field == SORT_FIELD_AGE) {
+             pRecord->key[word++] = (uint64_t)((uint32_t)pStudent->ageStudent ^ 0x80000000U) ^ invert;
+         } else {
+             pRecord->key[word++] = (uint64_t)orderedFloatBits(pStudent->GPA) ^ invert;
+         }
      }
  }
  
  /**
-  * @brief Add a node to the tail of the linked list
-  * @param pList Pointer to the linked list
-  * @param pNewNode Pointer to the new node
+  * @brief Compare two packed records
+  * @param pA First record
+  * @param pB Second record
+  * @param pPlan Key layout
+  * @return Negative if A sorts first, positive if B sorts first, 0 if equal
   */
- void addTail(LinkedList *pList, Node *pNewNode) {
-     if (pList->pHead == NULL) {
-         pList->pHead = pNewNode; /* If list is empty, set head and tail */
-         pList->pTail = pNewNode;
-     } else {
-         pList->pTail->pNextNode = pNewNode; /* Link current tail to new node */
-         pList->pTail = pNewNode;            /* Update tail to new node */
+ static int compareRecords(const SortRecord *pA, const SortRecord *pB, const SortPlan *pPlan) {
+     for (int w = 0; w < pPlan->nWords; w++) {
+         if (pA->key[w] != pB->key[w]) {
+             return (pA->key[w] < pB->key[w]) ? -1 : 1;
+         }
+         if (w == pPlan->nameTailWord) {
+             uint64_t low = pPlan->nameDescending ? ~pA->key[w] : pA->key[w];
+             if ((low & 0xFFU) != 0) { /* Prefix has no terminator: compare the tails */
+                 int cmp = strcmp(pA->pNode->dataStudent.nameStudent + SORT_NAME_PREFIX,
+                                  pB->pNode->dataStudent.nameStudent + SORT_NAME_PREFIX);
+                 if (cmp != 0) return pPlan->nameDescending ? -cmp : cmp;
+             }
+         }
      }
+     return 0;
  }
  
  /**
-  * @brief Insert a new student before a student with a specific name
-  * @param pList Pointer to the linked list
-  * @param newStudent New student data
-  * @param nameTarget Name of the student to insert before
+  * @brief Stable merge sort of packed records
+  * @param pRecords Records to sort
+  * @param pBuffer Scratch buffer of the same length
+  * @param count Number of records
+  * @param pPlan Key layout
+  * @return Array (pRecords or pBuffer) that holds the sorted records
   */
- void insertBeforeStudent(LinkedList *pList, Student newStudent, const char *nameTarget) {
-     Node *current = pList->pHead;
-     Node *prev = NULL;
-     while (current != NULL) {
-         if (strcmp(current->dataStudent.nameStudent, nameTarget) == 0) {
-             Node *newNode = createNode(newStudent);
-             if (prev == NULL) {
-                 addHead(pList, newNode); /* Insert at head if target is head */
-             } else {
-                 newNode->pNextNode = current; /* Link new node before target */
-                 prev->pNextNode = newNode;
+ static SortRecord* sortRecords(SortRecord *pRecords, SortRecord *pBuffer, size_t count, const SortPlan *pPlan) {
+     SortRecord *pSrc = pRecords;
+     SortRecord *pDst = pBuffer;
+     size_t width;
+ 
+     for (size_t start = 0; start < count; start += SORT_SMALL_RUN) {
+         size_t end = (start + SORT_SMALL_RUN < count) ? start + SORT_SMALL_RUN : count;
+         for (size_t i = start + 1; i < end; i++) {
+             SortRecord temp = pSrc[i];
+             size_t j = i;
+             while (j > start && compareRecords(&temp, &pSrc[j - 1], pPlan) < 0) {
+                 pSrc[j] = pSrc[j - 1];
+                 j--;
              }
-             return;
+             pSrc[j] = temp;
          }
-         prev = current;
-         current = current->pNextNode;
      }
-     printf("Student with name %s not found!\n", nameTarget);
+     for (width = SORT_SMALL_RUN; width < count; width *= 2) {
+         for (size_t left = 0; left < count; left += 2 * width) {
+             size_t mid = (left + width < count) ? left + width : count;
+             size_t right = (left + 2 * width < count) ? left + 2 * width : count;
+             size_t i = left, j = mid, k = left;
+             while (i < mid && j < right) {
+                 pDst[k++] = (compareRecords(&pSrc[j], &pSrc[i], pPlan) < 0) ? pSrc[j++] : pSrc[i++];
+             }
+             while (i < mid) pDst[k++] = pSrc[i++];
+             while (j < right) pDst[k++] = pSrc[j++];
+         }
+         SortRecord *pSwap = pSrc; /* Ping-pong between the two arrays */
+         pSrc = pDst;
+         pDst = pSwap;
+     }
+     return pSrc;
  }
  
  /**
-  * @brief Insert a new student after a student with a specific name
-  * @param pList Pointer to the linked list
-  * @param newStudent New student data
-  * @param nameTarget Name of the student to insert after
+  * @brief Stable LSD radix sort of packed records without comparisons
+  * @param pRecords Records to sort
+  * @param pBuffer Scratch buffer of the same length
+  * @param count Number of records
+  * @param nWords Number of key words in use
+  * @return Array (pRecords or pBuffer) that holds the sorted records, NULL if out of memory
+  * @note  Only valid for keys that need no tie-break outside the words (age and GPA)
   */
- void insertAfterStudent(LinkedList *pList, Student newStudent, const char *nameTarget) {
-     Node *current = pList->pHead;
-     while (current != NULL) {
-         if (strcmp(current->dataStudent.nameStudent, nameTarget) == 0) {
-             Node *newNode = createNode(newStudent);
-             newNode->pNextNode = current->pNextNode; /* Link new node after target */
-             current->pNextNode = newNode;
-             if (current == pList->pTail) {
-                 pList->pTail = newNode; /* Update tail if inserted after last node */
+ static SortRecord* radixSortRecords(SortRecord *pRecords, SortRecord *pBuffer, size_t count, int nWords) {
+     size_t (*histogram)[SORT_RADIX_BUCKETS] = calloc((size_t)nWords * 8, sizeof(*histogram));
+     SortRecord *pSrc = pRecords;
+     SortRecord *pDst = pBuffer;
+ 
+     if (histogram == NULL) return NULL;
+     for (size_t i = 0; i < count; i++) { /* Every digit histogram in a single pass */
+         for (int w = 0; w < nWords; w++) {
+             uint64_t key = pRecords[i].key[w];
+             for (int b = 0; b < 8; b++) {
+                 histogram[w * 8 + b][(key >> (8 * b)) & 0xFFU]++;
              }
-             return;
          }
-         current = current->pNextNode;
      }
-     printf("Student with name %s not found!\n", nameTarget);
+     for (int w = nWords - 1; w >= 0; w--) {
+         for (int b = 0; b < 8; b++) {
+             size_t *pCount = histogram[w * 8 + b];
+             size_t offset = 0;
+             unsigned int digit;
+             for (digit = 0; digit < SORT_RADIX_BUCKETS; digit++) {
+                 if (pCount[digit] == count) break; /* Byte is constant: pass would be a no-op */
+                 size_t bucket = pCount[digit];
+                 pCount[digit] = offset;
+                 offset += bucket;
+             }
+             if (digit < SORT_RADIX_BUCKETS) continue;
+             for (size_t i = 0; i < count; i++) {
+                 pDst[pCount[(pSrc[i].key[w] >> (8 * b)) & 0xFFU]++] = pSrc[i];
+             }
+             SortRecord *pSwap = pSrc;
+             pSrc = pDst;
+             pDst = pSwap;
+         }
+     }
+     free(histogram);
+     return pSrc;
  }
  
  /**
-  * @brief Insert a new student at a specific position
-  * @param pList Pointer to the linked list
-  * @param newStudent New student data
-  * @param position Position to insert the student (1-based index)
+  * @brief Pack and sort one segment of records
+  * @param pTask Pointer to a SortSegment
   */
- void insertSpecificPosition(LinkedList *pList, Student newStudent, int position) {
-     if (position < 1) {
-         printf("Invalid position!\n");
-         return;
-     }
-     if (position == 1) {
-         Node *newNode = createNode(newStudent);
-         addHead(pList, newNode); /* Insert at head if position is 1 */
-         return;
-     }
-     Node *current = pList->pHead;
-     for (int i = 1; i < position - 1 && current != NULL; i++) {
-         current = current->pNextNode;
+ static void sortSegmentTask(void *pTask) {
+     SortSegment *pSegment = (SortSegment*)pTask;
+     for (size_t i = 0; i < pSegment->count; i++) {
+         packSortRecord(&pSegment->pRecords[i], pSegment->keys, pSegment->nkeys);
      }
-     if (current == NULL) {
-         printf("Position out of range!\n");
-         return;
+     pSegment->pSorted = NULL;
+     if (pSegment->pPlan->nameTailWord < 0) { /* Numeric keys only */
+         pSegment->pSorted = radixSortRecords(pSegment->pRecords, pSegment->pBuffer, pSegment->count,
+                                              pSegment->pPlan->nWords);
      }
-     Node *newNode = createNode(newStudent);
-     newNode->pNextNode = current->pNextNode; /* Link new node at position */
-     current->pNextNode = newNode;
-     if (newNode->pNextNode == NULL) {
-         pList->pTail = newNode; /* Update tail if inserted at end */
+     if (pSegment->pSorted == NULL) {
+         pSegment->pSorted = sortRecords(pSegment->pRecords, pSegment->pBuffer, pSegment->count, pSegment->pPlan);
      }
  }
  
  /**
-  * @brief Delete the head of the linked list
-  * @param pList Pointer to the linked list
+  * @brief Check whether the head of one sorted segment goes before another's
+  * @param segments Sorted segments
+  * @param next Index of the next unmerged record of each segment
+  * @param a First segment index
+  * @param b Second segment index
+  * @param pPlan Key layout
+  * @return 1 if segment a's record goes first; equal records keep list order
   */
- void deleteHead(LinkedList *pList) {
-     if (pList->pHead == NULL) {
-         printf("List is empty!\n");
-         return;
-     }
-     Node *temp = pList->pHead;
-     pList->pHead = pList->pHead->pNextNode; /* Move head to next node */
-     if (pList->pHead == NULL) {
-         pList->pTail = NULL; /* Update tail if list becomes empty */
-     }
-     free(temp); /* Free memory of deleted node */
+ static int segmentHeadFirst(const SortSegment *segments, const size_t *next, int a, int b, const SortPlan *pPlan) {
+     int cmp = compareRecords(&segments[a].pSorted[next[a]], &segments[b].pSorted[next[b]], pPlan);
+     return (cmp != 0) ? (cmp < 0) : (a < b); /* Earlier segment holds the earlier nodes */
  }
  
  /**
-  * @brief Delete the tail of the linked list
+  * @brief Relink a list from sorted segments with a k-way merge
   * @param pList Pointer to the linked list
+  * @param segments Sorted segments, in list order
+  * @param nSegments Number of segments
+  * @param pPlan Key layout
+  * @note  A binary heap of segment indexes picks the next record, so each
+  *        node costs O(log k) comparisons and is linked exactly once
   */
- void deleteLast(LinkedList *pList) {
-     if (pList->pHead == NULL) {
-         printf("List is empty!\n");
-         return;
-     }
-     if (pList->pHead == pList->pTail) {
-         free(pList->pHead); /* Free single node if list has one node */
-         pList->pHead = NULL;
-         pList->pTail = NULL;
-         return;
+ static void mergeSortedSegments(LinkedList *pList, const SortSegment *segments, int nSegments, const SortPlan *pPlan) {
+     size_t next[MAX_WORKER_THREADS] = { 0 };
+     int heap[MAX_WORKER_THREADS];
+     int heapSize = 0;
+     Node dummy;
+     Node *pLast = &dummy;
+ 
+     for (int i = 0; i < nSegments; i++) {
+         int child = heapSize++;
+         while (child > 0 && segmentHeadFirst(segments, next, i, heap[(child - 1) / 2], pPlan)) {
+             heap[child] = heap[(child - 1) / 2];
+             child = (child - 1) / 2;
+         }
+         heap[child] = i;
      }
-     Node *current = pList->pHead;
-     while (current->pNextNode != pList->pTail) {
-         current = current->pNextNode;
+     while (heapSize > 0) {
+         int top = heap[0];
+         int parent = 0;
+         pLast->pNextNode = segments[top].pSorted[next[top]++].pNode;
+         pLast = pLast->pNextNode;
+         if (next[top] == segments[top].count) top = heap[--heapSize]; /* Segment used up */
+         for (;;) { /* Sift top down from the root */
+             int child = 2 * parent + 1;
+             if (child >= heapSize) break;
+             if (child + 1 < heapSize && segmentHeadFirst(segments, next, heap[child + 1], heap[child], pPlan)) child++;
+             if (!segmentHeadFirst(segments, next, heap[child], top, pPlan)) break;
+             heap[parent] = heap[child];
+             parent = child;
+         }
+         if (heapSize > 0) heap[parent] = top;
      }
-     free(pList->pTail); /* Free tail node */
-     pList->pTail = current; /* Update tail */
-     pList->pTail->pNextNode = NULL;
+     pLast->pNextNode = NULL;
+     pList->pHead = dummy.pNextNode;
+     pList->pTail = pLast;
  }
  
  /**
-  * @brief Delete the node before a student with a specific name
-  * @param pList Pointer to the linked list
-  * @param nameTarget Name of the target student
+  * @brief Validate sort keys and drop repeated fields
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
+  * @param pUnique Receives at most LIST_MAX_ORDER_KEYS keys
+  * @return Number of keys kept, 0 if the keys are invalid
   */
- void deleteBeforeStudent(LinkedList *pList, const char *nameTarget) {
-     if (pList->pHead == NULL || pList->pHead->pNextNode == NULL) {
-         printf("Cannot delete before the first student!\n");
-         return;
-     }
-     Node *current = pList->pHead;
-     Node *prev = NULL;
-     Node *prevPrev = NULL;
-     while (current != NULL) {
-         if (strcmp(current->dataStudent.nameStudent, nameTarget) == 0) {
-             if (prev == pList->pHead) {
-                 deleteHead(pList); /* Delete head if target is second node */
-             } else if (prev != NULL) {
-                 prevPrev->pNextNode = current; /* Skip node before target */
-                 free(prev);
-             }
-             return;
+ static int normalizeSortKeys(const SortKey *keys, int nkeys, SortKey *pUnique) {
+     int seen[LIST_MAX_ORDER_KEYS] = { 0, 0, 0 };
+     int nUnique = 0;
+     if (keys == NULL || nkeys < 1) return 0;
+     for (int k = 0; k < nkeys; k++) {
+         if ((unsigned int)keys[k].field > SORT_FIELD_GPA || (unsigned int)keys[k].direction > SORT_DESCENDING) {
+             return 0;
          }
-         prevPrev = prev;
-         prev = current;
-         current = current->pNextNode;
+         if (seen[keys[k].field]) continue; /* A repeated field can never break a tie */
+         seen[keys[k].field] = 1;
+         pUnique[nUnique++] = keys[k];
      }
-     printf("Student with name %s not found!\n", nameTarget);
+     return nUnique;
  }
  
  /**
-  * @brief Delete the node after a student with a specific name
-  * @param pList Pointer to the linked list
-  * @param nameTarget Name of the target student
+  * @brief Check whether two normalized key lists are the same
+  * @param pA First keys
+  * @param nA Number of first keys
+  * @param pB Second keys
+  * @param nB Number of second keys
+  * @return 1 if equal, 0 otherwise
   */
- void deleteAfterStudent(LinkedList *pList, const char *nameTarget) {
-     Node *current = pList->pHead;
-     while (current != NULL) {
-         if (strcmp(current->dataStudent.nameStudent, nameTarget) == 0) {
-             if (current->pNextNode != NULL) {
-                 Node *temp = current->pNextNode;
-                 current->pNextNode = temp->pNextNode; /* Skip node after target */
-                 if (temp == pList->pTail) {
-                     pList->pTail = current; /* Update tail if deleted node was tail */
-                 }
-                 free(temp);
-             } else {
-                 printf("No student after %s!\n", nameTarget);
-             }
-             return;
-         }
-         current = current->pNextNode;
+ static int sameSortKeys(const SortKey *pA, int nA, const SortKey *pB, int nB) {
+     if (nA != nB) return 0;
+     for (int k = 0; k < nA; k++) {
+         if (pA[k].field != pB[k].field || pA[k].direction != pB[k].direction) return 0;
      }
-     printf("Student with name %s not found!\n", nameTarget);
+     return 1;
  }
  
  /**
-  * @brief Delete a student at a specific position
+  * @brief Stable sort of the linked list by several keys in priority order
   * @param pList Pointer to the linked list
-  * @param position Position of the student to delete (1-based index)
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
   */
- void deleteSpecificPosition(LinkedList *pList, int position) {
-     if (position < 1) {
-         printf("Invalid position!\n");
+ void sortList(LinkedList *pList, const SortKey *keys, int nkeys) {
+     sortListParallel(pList, keys, nkeys, sortThreadCount);
+ }
+ 
+ /**
+  * @brief Stable sort of the linked list on several threads
+  * @param pList Pointer to the linked list
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
+  * @param threadCount Number of threads, 0 for one per hardware thread
+  */
+ void sortListParallel(LinkedList *pList, const SortKey *keys, int nkeys, int threadCount) {
+     static const StudentCompare_TypeDef fieldCompare[3][2] = {
+         { compareNameAsc, compareNameDesc },   /* SORT_FIELD_NAME */
+         { compareAgeAsc, compareAgeDesc },     /* SORT_FIELD_AGE */
+         { compareScoreAsc, compareScoreDesc }  /* SORT_FIELD_GPA */
+     };
+     SortKey uniqueKeys[LIST_MAX_ORDER_KEYS];
+     SortSegment segments[MAX_WORKER_THREADS];
+     int nUnique = normalizeSortKeys(keys, nkeys, uniqueKeys);
+     SortPlan plan = { 0, -1, 0 };
+     size_t count = 0;
+     size_t start = 0;
+ 
+     if (nUnique == 0) {
+         printf("Invalid sort keys!\n");
          return;
      }
-     if (position == 1) {
-         deleteHead(pList); /* Delete head if position is 1 */
+     if (pList->orderKeyCount > 0) {
+         if (sameSortKeys(uniqueKeys, nUnique, pList->orderKeys, pList->orderKeyCount)) return; /* Kept sorted by every insert */
+         memcpy(pList->orderKeys, uniqueKeys, (size_t)nUnique * sizeof(SortKey)); /* New keys become the maintained order */
+         pList->orderKeyCount = nUnique;
+     }
+     if (pList->pHead == NULL || pList->pHead->pNextNode == NULL) return;
+ 
+     count = (size_t)pList->nodeCount;
+     SortRecord *pRecords = (SortRecord*)malloc(2 * count * sizeof(SortRecord));
+     if (pRecords == NULL) {
+         /* No memory for packed keys: stable in-place sorts, least significant key first */
+         for (int k = nUnique - 1; k >= 0; k--) {
+             mergeSortList(pList, fieldCompare[uniqueKeys[k].field][uniqueKeys[k].direction]);
+         }
+         noteReorder(pList);
+         rebuildSortedIndexes(pList);
          return;
      }
-     Node *current = pList->pHead;
-     for (int i = 1; i < position - 1 && current != NULL; i++) {
-         current = current->pNextNode;
+     for (int k = 0; k < nUnique; k++) {
+         if (uniqueKeys[k].field == SORT_FIELD_NAME) {
+             plan.nameTailWord = plan.nWords + 1;
+             plan.nameDescending = (uniqueKeys[k].direction == SORT_DESCENDING);
+             plan.nWords += 2;
+         } else {
+             plan.nWords += 1;
+         }
      }
-     if (current == NULL || current->pNextNode == NULL) {
-         printf("Position out of range!\n");
-         return;
+     if (threadCount <= 0) threadCount = hardwareThreadCount();
+     if (threadCount > MAX_WORKER_THREADS) threadCount = MAX_WORKER_THREADS;
+     if ((size_t)threadCount > count / SORT_PARALLEL_MIN_NODES) threadCount = (int)(count / SORT_PARALLEL_MIN_NODES);
+     if (threadCount < 1) threadCount = 1;
+     size_t i = 0;
+     for (Node *current = pList->pHead; current != NULL; current = current->pNextNode, i++) {
+         pRecords[i].pNode = current; /* Keys are packed by the sorting threads */
      }
-     Node *temp = current->pNextNode;
-     current->pNextNode = temp->pNextNode; /* Skip node at position */
-     if (temp == pList->pTail) {
-         pList->pTail = current; /* Update tail if deleted node was tail */
+     for (int t = 0; t < threadCount; t++) {
+         size_t end = count * (size_t)(t + 1) / (size_t)threadCount;
+         segments[t].pRecords = pRecords + start;
+         segments[t].pBuffer = pRecords + count + start;
+         segments[t].count = end - start;
+         segments[t].keys = uniqueKeys;
+         segments[t].nkeys = nUnique;
+         segments[t].pPlan = &plan;
+         start = end;
      }
-     free(temp);
+     runWorkerTasks(sortSegmentTask, segments, sizeof(segments[0]), threadCount);
+     mergeSortedSegments(pList, segments, threadCount, &plan); /* Relink in sorted order */
+     free(pRecords);
+     noteReorder(pList); /* Predecessors and positions changed everywhere */
+     rebuildSortedIndexes(pList); /* So did the label order */
  }
  
  /**
-  * @brief Edit the student at the head of the linked list
+  * @brief Set the number of threads used by sortList and the sortBy functions
+  * @param threadCount Number of threads, 0 for one per hardware thread, 1 to sort serially
+  */
+ void setSortThreadCount(int threadCount) {
+     sortThreadCount = (threadCount < 0) ? 1 : threadCount;
+ }
+ 
+ /**
+  * @brief Keep the list sorted by keys from now on
   * @param pList Pointer to the linked list
-  * @param newStudent New student data
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
+  * @return 1 on success, 0 if the keys are invalid (a message is printed)
   */
- void editHead(LinkedList *pList, Student newStudent) {
-     if (pList->pHead == NULL) {
-         printf("List is empty!\n");
-         return;
+ int setMaintainedOrder(LinkedList *pList, const SortKey *keys, int nkeys) {
+     SortKey uniqueKeys[LIST_MAX_ORDER_KEYS];
+     int nUnique = normalizeSortKeys(keys, nkeys, uniqueKeys);
+     if (nUnique == 0) {
+         printf("Invalid sort keys!\n");
+         return 0;
+     }
+     if (!sameSortKeys(uniqueKeys, nUnique, pList->orderKeys, pList->orderKeyCount)) {
+         memcpy(pList->orderKeys, uniqueKeys, (size_t)nUnique * sizeof(SortKey));
+         pList->orderKeyCount = nUnique;
+         restoreOrder(pList); /* The only full sort: the keys changed */
      }
-     pList->pHead->dataStudent = newStudent; /* Update head data */
+     enablePositionIndex(pList); /* Ordered inserts walk the chain if it cannot be allocated */
+     return 1;
  }
  
  /**
-  * @brief Edit the student at the tail of the linked list
+  * @brief Stop keeping the list sorted; inserts go where they are asked again
   * @param pList Pointer to the linked list
-  * @param newStudent New student data
   */
- void editLast(LinkedList *pList, Student newStudent) {
-     if (pList->pTail == NULL) {
-         printf("List is empty!\n");
-         return;
+ void clearMaintainedOrder(LinkedList *pList) {
+     pList->orderKeyCount = 0;
+ }
+ 
+ /**
+  * @brief Compare two students by a list of sort keys
+  * @param pA First student
+  * @param pB Second student
+  * @param keys Sort keys, most significant first
+  * @param nkeys Number of keys
+  * @return Negative if A sorts first, positive if B sorts first, 0 if equal
+  */
+ int compareStudentsByKeys(const Student *pA, const Student *pB, const SortKey *keys, int nkeys) {
+     for (int k = 0; k < nkeys; k++) {
+         int cmp;
+         if (keys[k].field == SORT_FIELD_NAME) {
+             cmp = compareNameAsc(pA, pB);
+         } else if (keys[k].field == SORT_FIELD_AGE) {
+             cmp = compareAgeAsc(pA, pB);
+         } else {
+             cmp = compareScoreAsc(pA, pB);
+         }
+         if (cmp != 0) return (keys[k].direction == SORT_DESCENDING) ? -cmp : cmp;
      }
-     pList->pTail->dataStudent = newStudent; /* Update tail data */
+     return 0;
  }
  
  /**
-  * @brief Edit a student at a specific position
+  * @brief Sort the linked list by one field
   * @param pList Pointer to the linked list
-  * @param position Position of the student to edit (1-based index)
-  * @param newStudent New student data
+  * @param field Field to sort by
+  * @param direction Sort direction
   */
- void editSpecificPosition(LinkedList *pList, int position, Student newStudent) {
-     if (position < 1) {
-         printf("Invalid position!\n");
-         return;
-     }
-     Node *current = pList->pHead;
-     for (int i = 1; i < position && current != NULL; i++) {
-         current = current->pNextNode;
-     }
-     if (current == NULL) {
-         printf("Position out of range!\n");
-         return;
-     }
-     current->dataStudent = newStudent; /* Update data at position */
+ static void sortBySingleKey(LinkedList *pList, SortField_TypeDef field, SortDirection_TypeDef direction) {
+     SortKey key = { field, direction };
+     sortList(pList, &key, 1);
  }
  
  /**
@@ -341,21 +1709,7 @@
   * @param pList Pointer to the linked list
   */
  void sortByNameAsc(LinkedList *pList) {
-     if (pList->pHead == NULL) return;
-     int swapped;
-     do {
-         swapped = 0;
-         Node *current = pList->pHead;
-         while (current->pNextNode != NULL) {
-             if (strcmp(current->dataStudent.nameStudent, current->pNextNode->dataStudent.nameStudent) > 0) {
-                 Student temp = current->dataStudent;
-                 current->dataStudent = current->pNextNode->dataStudent; /* Swap data */
-                 current->pNextNode->dataStudent = temp;
-                 swapped = 1;
-             }
-             current = current->pNextNode;
-         }
-     } while (swapped);
+     sortBySingleKey(pList, SORT_FIELD_NAME, SORT_ASCENDING);
  }
  
  /**
@@ -363,21 +1717,7 @@
   * @param pList Pointer to the linked list
   */
  void sortByNameDesc(LinkedList *pList) {
-     if (pList->pHead == NULL) return;
-     int swapped;
-     do {
-         swapped = 0;
-         Node *current = pList->pHead;
-         while (current->pNextNode != NULL) {
-             if (strcmp(current->dataStudent.nameStudent, current->pNextNode->dataStudent.nameStudent) < 0) {
-                 Student temp = current->dataStudent;
-                 current->dataStudent = current->pNextNode->dataStudent; /* Swap data */
-                 current->pNextNode->dataStudent = temp;
-                 swapped = 1;
-             }
-             current = current->pNextNode;
-         }
-     } while (swapped);
+     sortBySingleKey(pList, SORT_FIELD_NAME, SORT_DESCENDING);
  }
  
  /**
@@ -385,21 +1725,7 @@
   * @param pList Pointer to the linked list
   */
  void sortByScoreAsc(LinkedList *pList) {
-     if (pList->pHead == NULL) return;
-     int swapped;
-     do {
-         swapped = 0;
-         Node *current = pList->pHead;
-         while (current->pNextNode != NULL) {
-             if (current->dataStudent.GPA > current->pNextNode->dataStudent.GPA) {
-                 Student temp = current->dataStudent;
-                 current->dataStudent = current->pNextNode->dataStudent; /* Swap data */
-                 current->pNextNode->dataStudent = temp;
-                 swapped = 1;
-             }
-             current = current->pNextNode;
-         }
-     } while (swapped);
+     sortBySingleKey(pList, SORT_FIELD_GPA, SORT_ASCENDING);
  }
  
  /**
@@ -407,21 +1733,7 @@
   * @param pList Pointer to the linked list
   */
  void sortByScoreDesc(LinkedList *pList) {
-     if (pList->pHead == NULL) return;
-     int swapped;
-     do {
-         swapped = 0;
-         Node *current = pList->pHead;
-         while (current->pNextNode != NULL) {
-             if (current->dataStudent.GPA < current->pNextNode->dataStudent.GPA) {
-                 Student temp = current->dataStudent;
-                 current->dataStudent = current->pNextNode->dataStudent; /* Swap data */
-                 current->pNextNode->dataStudent = temp;
-                 swapped = 1;
-             }
-             current = current->pNextNode;
-         }
-     } while (swapped);
+     sortBySingleKey(pList, SORT_FIELD_GPA, SORT_DESCENDING);
  }
  
  /**
@@ -429,21 +1741,7 @@
   * @param pList Pointer to the linked list
   */
  void sortByAgeAsc(LinkedList *pList) {
-     if (pList->pHead == NULL) return;
-     int swapped;
-     do {
-         swapped = 0;
-         Node *current = pList->pHead;
-         while (current->pNextNode != NULL) {
-             if (current->dataStudent.ageStudent > current->pNextNode->dataStudent.ageStudent) {
-                 Student temp = current->dataStudent;
-                 current->dataStudent = current->pNextNode->dataStudent; /* Swap data */
-                 current->pNextNode->dataStudent = temp;
-                 swapped = 1;
-             }
-             current = current->pNextNode;
-         }
-     } while (swapped);
+     sortBySingleKey(pList, SORT_FIELD_AGE, SORT_ASCENDING);
  }
  
  /**
@@ -451,21 +1749,7 @@
   * @param pList Pointer to the linked list
   */
  void sortByAgeDesc(LinkedList *pList) {
-     if (pList->pHead == NULL) return;
-     int swapped;
-     do {
-         swapped = 0;
-         Node *current = pList->pHead;
-         while (current->pNextNode != NULL) {
-             if (current->dataStudent.ageStudent < current->pNextNode->dataStudent.ageStudent) {
-                 Student temp = current->dataStudent;
-                 current->dataStudent = current->pNextNode->dataStudent; /* Swap data */
-                 current->pNextNode->dataStudent = temp;
-                 swapped = 1;
-             }
-             current = current->pNextNode;
-         }
-     } while (swapped);
+     sortBySingleKey(pList, SORT_FIELD_AGE, SORT_DESCENDING);
  }
  
  /**
@@ -474,26 +1758,295 @@
   * @return Number of nodes in the list
   */
  int countNodes(LinkedList *pList) {
+     return pList->nodeCount;
+ }
+ 
+ /**
+  * @brief Store a 32-bit value in little-endian order
+  * @param pOut Destination bytes
+  * @param value Value to store
+  */
+ static void storeLe32(unsigned char *pOut, uint32_t value) {
+     pOut[0] = (unsigned char)value;
+     pOut[1] = (unsigned char)(value >> 8);
+     pOut[2] = (unsigned char)(value >> 16);
+     pOut[3] = (unsigned char)(value >> 24);
+ }
+ 
+ /**
+  * @brief Load a 32-bit little-endian value
+  * @param pIn Source bytes
+  * @return Value
+  */
+ static uint32_t loadLe32(const unsigned char *pIn) {
+     return (uint32_t)pIn[0] | ((uint32_t)pIn[1] << 8) | ((uint32_t)pIn[2] << 16) | ((uint32_t)pIn[3] << 24);
+ }
+ 
+ /**
+  * @brief Add a chunk of record bytes to the checksum
+  * @param pChecksum Checksum to update
+  * @param pBytes Record bytes
+  * @param size Number of bytes; a multiple of 4 except for the last chunk
+  * @note  Fletcher-style sums over 32-bit words run at memory speed, unlike a
+  *        byte-at-a-time CRC
+  */
+ void updateRosterChecksum(RosterChecksum *pChecksum, const unsigned char *pBytes, size_t size) {
+     uint64_t sum = pChecksum->sum, sumOfSums = pChecksum->sumOfSums;
+     size_t i = 0;
+     for (; i + 4 <= size; i += 4) {
+         sum += loadLe32(pBytes + i);
+         sumOfSums += sum;
+     }
+     if (i < size) {
+         unsigned char tail[4] = {0, 0, 0, 0}; /* Zero pad the final partial word */
+         memcpy(tail, pBytes + i, size - i);
+         sum += loadLe32(tail);
+         sumOfSums += sum;
+     }
+     pChecksum->sum = sum;
+     pChecksum->sumOfSums = sumOfSums;
+ }
+ 
+ /**
+  * @brief Fold the checksum sums into the value stored in the header
+  * @param pChecksum Checksum to finish
+  * @return 64-bit checksum
+  */
+ uint64_t finishRosterChecksum(const RosterChecksum *pChecksum) {
+     return (pChecksum->sumOfSums << 32) ^ pChecksum->sum;
+ }
+ 
+ /**
+  * @brief Encode the roster header
+  * @param pOut ROSTER_HEADER_SIZE bytes
+  * @param count Number of records
+  * @param checksum Checksum of the record bytes
+  */
+ static void packRosterHeader(unsigned char *pOut, uint64_t count, uint64_t checksum) {
+     memset(pOut, 0, ROSTER_HEADER_SIZE);
+     memcpy(pOut, ROSTER_MAGIC, 4);
+     pOut[4] = (unsigned char)ROSTER_VERSION;
+     pOut[6] = (unsigned char)ROSTER_RECORD_SIZE;
+     storeLe32(pOut + 16, (uint32_t)count);
+     storeLe32(pOut + 20, (uint32_t)(count >> 32));
+     storeLe32(pOut + 24, (uint32_t)checksum);
+     storeLe32(pOut + 28, (uint32_t)(checksum >> 32));
+ }
+ 
+ /**
+  * @brief Validate a roster file header
+  * @param pHeader ROSTER_HEADER_SIZE bytes read from the file
+  * @param pCount Receives the record count
+  * @param pChecksum Receives the stored checksum
+  * @return NULL if the header is valid, otherwise an error message
+  */
+ const char* checkRosterHeader(const unsigned char *pHeader, uint64_t *pCount, uint64_t *pChecksum) {
+     if (memcmp(pHeader, ROSTER_MAGIC, 4) != 0) {
+         return "Not a roster file!";
+     }
+     if (pHeader[4] != ROSTER_VERSION || pHeader[5] != 0
+         || pHeader[6] != ROSTER_RECORD_SIZE || pHeader[7] != 0) {
+         return "Unsupported roster file version!";
+     }
+     *pCount = loadLe32(pHeader + 16) | ((uint64_t)loadLe32(pHeader + 20) << 32);
+     *pChecksum = loadLe32(pHeader + 24) | ((uint64_t)loadLe32(pHeader + 28) << 32);
+     if (*pCount > (uint64_t)INT_MAX) {
+         return "Roster file is corrupted!";
+     }
+     return NULL;
+ }
+ 
+ /**
+  * @brief Encode a student as a roster record
+  * @param pOut ROSTER_RECORD_SIZE bytes
+  * @param pStudent Student to encode
+  */
+ void packRosterRecord(unsigned char *pOut, const Student *pStudent) {
+     const char *pEnd = (const char*)memchr(pStudent->nameStudent, '\0', ROSTER_NAME_SIZE - 1);
+     size_t length = (pEnd != NULL) ? (size_t)(pEnd - pStudent->nameStudent) : ROSTER_NAME_SIZE - 1;
+     uint32_t gpaBits;
+     memcpy(pOut, pStudent->nameStudent, length);
+     memset(pOut + length, 0, ROSTER_NAME_SIZE - length); /* No stray bytes after the name */
+     storeLe32(pOut + ROSTER_NAME_SIZE, (uint32_t)pStudent->ageStudent);
+     memcpy(&gpaBits, &pStudent->GPA, sizeof(gpaBits));
+     storeLe32(pOut + ROSTER_NAME_SIZE + 4, gpaBits);
+ }
+ 
+ /**
+  * @brief Decode a roster record
+  * @param pRecord ROSTER_RECORD_SIZE bytes
+  * @param pStudent Receives the student
+  * @return 1 on success, 0 if the name is not terminated
+  */
+ int unpackRosterRecord(const unsigned char *pRecord, Student *pStudent) {
+     uint32_t gpaBits = loadLe32(pRecord + ROSTER_NAME_SIZE + 4);
+     if (memchr(pRecord, '\0', ROSTER_NAME_SIZE) == NULL) {
+         return 0;
+     }
+     memcpy(pStudent->nameStudent, pRecord, ROSTER_NAME_SIZE);
+     pStudent->ageStudent = (int)loadLe32(pRecord + ROSTER_NAME_SIZE);
+     memcpy(&pStudent->GPA, &gpaBits, sizeof(gpaBits));
+     return 1;
+ }
+ 
+ /**
+  * @brief Save the list to a binary roster file
+  * @param pList Pointer to the linked list
+  * @param filename Name of the file to write
+  * @return 1 on success, 0 on failure (a message is printed)
+  */
+ int saveListBinary(LinkedList *pList, const char *filename) {
+     unsigned char header[ROSTER_HEADER_SIZE];
+     unsigned char *pBuffer;
+     RosterChecksum checksum = {0, 0};
+     size_t filled = 0;
+     int ok = 1;
+     FILE *file = fopen(filename, "wb");
+     if (file == NULL) {
+         printf("Error opening file for writing.\n");
+         return 0;
+     }
+     pBuffer = (unsigned char*)malloc(ROSTER_CHUNK_RECORDS * ROSTER_RECORD_SIZE);
+     if (pBuffer == NULL) {
+         printf("Memory allocation failed!\n");
+         fclose(file);
+         return 0;
+     }
+     packRosterHeader(header, (uint64_t)pList->nodeCount, 0); /* Checksum patched in at the end */
+     ok = (fwrite(header, 1, ROSTER_HEADER_SIZE, file) == ROSTER_HEADER_SIZE);
+     for (Node *current = pList->pHead; ok && current != NULL; current = current->pNextNode) {
+         packRosterRecord(pBuffer + filled * ROSTER_RECORD_SIZE, &current->dataStudent);
+         if (++filled == ROSTER_CHUNK_RECORDS || current->pNextNode == NULL) {
+             updateRosterChecksum(&checksum, pBuffer, filled * ROSTER_RECORD_SIZE);
+             ok = (fwrite(pBuffer, ROSTER_RECORD_SIZE, filled, file) == filled);
+             filled = 0;
+         }
+     }
+     if (ok) {
+         packRosterHeader(header, (uint64_t)pList->nodeCount, finishRosterChecksum(&checksum));
+         ok = (fseek(file, 0, SEEK_SET) == 0 && fwrite(header, 1, ROSTER_HEADER_SIZE, file) == ROSTER_HEADER_SIZE);
+     }
+     free(pBuffer);
+     if (fclose(file) != 0) ok = 0;
+     if (!ok) {
+         printf("Error writing to file!\n");
+     }
+     return ok;
+ }
+ 
+ /**
+  * @brief Replace the list with the contents of a binary roster file
+  * @param pList Pointer to the linked list
+  * @param filename Name of the file to read
+  * @return 1 on success, 0 on failure (a message is printed and the list is unchanged)
+  */
+ int loadListBinary(LinkedList *pList, const char *filename) {
+     unsigned char header[ROSTER_HEADER_SIZE];
+     unsigned char *pBuffer = NULL;
+     RosterChecksum checksum = {0, 0};
+     Node *pBlock = NULL;
+     uint64_t count = 0, storedChecksum = 0;
+     size_t loaded = 0;
+     const char *error = NULL;
+     FILE *file = fopen(filename, "rb");
+     if (file == NULL) {
+         printf("Error opening file for reading.\n");
+         return 0;
+     }
+     if (fread(header, 1, ROSTER_HEADER_SIZE, file) != ROSTER_HEADER_SIZE) {
+         error = "Not a roster file!";
+     } else {
+         error = checkRosterHeader(header, &count, &storedChecksum);
+     }
+     if (error == NULL && count != 0) {
+         pBuffer = (unsigned char*)malloc(ROSTER_CHUNK_RECORDS * ROSTER_RECORD_SIZE);
+         pBlock = (pBuffer != NULL) ? poolAllocBlock(&defaultPool, (size_t)count) : NULL;
+         if (pBlock == NULL) error = "Memory allocation failed!";
+     }
+ 
+     /* Decode straight into the block; node i links to node i + 1 */
+     while (error == NULL && loaded < count) {
+         size_t want = (count - loaded < ROSTER_CHUNK_RECORDS) ? (size_t)(count - loaded) : ROSTER_CHUNK_RECORDS;
+         if (fread(pBuffer, ROSTER_RECORD_SIZE, want, file) != want) {
+             error = "Roster file is truncated!";
+             break;
+         }
+         updateRosterChecksum(&checksum, pBuffer, want * ROSTER_RECORD_SIZE);
+         for (size_t i = 0; i < want; i++, loaded++) {
+             Node *pNode = pBlock + loaded;
+             if (!unpackRosterRecord(pBuffer + i * ROSTER_RECORD_SIZE, &pNode->dataStudent)) {
+                 error = "Roster file is corrupted!"; /* Unterminated name */
+                 break;
+             }
+             pNode->pNextNode = pNode + 1;
+         }
+     }
+     if (error == NULL && finishRosterChecksum(&checksum) != storedChecksum) {
+         error = "Roster file is corrupted!";
+     }
+     free(pBuffer);
+     fclose(file);
+     if (error != NULL) {
+         if (pBlock != NULL) {
+             for (size_t i = 0; i + 1 < (size_t)count; i++) pBlock[i].pNextNode = &pBlock[i + 1];
+             poolFreeChain(&defaultPool, pBlock, pBlock + count - 1);
+         }
+         printf("%s\n", error);
+         return 0;
+     }
+ 
+     poolFreeChain(&defaultPool, pList->pHead, pList->pTail); /* Drop the old contents */
+     if (count == 0) {
+         pList->pHead = NULL;
+         pList->pTail = NULL;
+     } else {
+         pBlock[count - 1].pNextNode = NULL;
+         pList->pHead = pBlock;
+         pList->pTail = pBlock + count - 1;
+     }
+     pList->nodeCount = (int)count;
+     noteReorder(pList);
+     rebuildSortedIndexes(pList); /* Every node is new */
+     restoreOrder(pList);
+     return 1;
+ }
+ 
+ #ifndef NDEBUG
+ /**
+  * @brief Walk the list and check the stored count and tail against it (debug builds)
+  * @param pList Pointer to the linked list
+  * @return 1 if consistent, 0 otherwise (the mismatch is printed)
+  */
+ int checkListConsistency(LinkedList *pList) {
      int count = 0;
-     Node *current = pList->pHead;
-     while (current != NULL) {
+     Node *last = NULL;
+     for (Node *current = pList->pHead; current != NULL; current = current->pNextNode) {
          count++;
-         current = current->pNextNode; /* Move to next node */
+         last = current;
+     }
+     if (count != pList->nodeCount || last != pList->pTail) {
+         printf("List inconsistent: stored count %d, walked %d, tail %s\n",
+                pList->nodeCount, count, (last == pList->pTail) ? "ok" : "wrong");
+         return 0;
      }
-     return count;
+     return 1;
  }
+ #endif
  
  /**
  * @brief Free all nodes in the linked list
  * @param pList Pointer to the linked list
  */
 void freeLinkedList(LinkedList *pList) {
-    Node *current = pList->pHead;
-    while (current != NULL) {
-        Node *temp = current;
-        current = current->pNextNode;
-        free(temp); /* Free each node */
-    }
+    poolFreeChain(&defaultPool, pList->pHead, pList->pTail); /* Hand the whole chain back at once */
+    disableNameIndex(pList);
+    disablePositionIndex(pList);
+    disableRangeIndex(pList);
+    disablePrefixIndex(pList);
+    pList->orderKeyCount = 0; /* An emptied list goes back to plain inserts */
     pList->pHead = NULL;
     pList->pTail = NULL;
+    pList->nodeCount = 0;
+    pList->changeCount++; /* Counters keep running so snapshots see the reset */
+    pList->reshapeCount++;
 }
\ No newline at end of file
@@ -26,6 +26,24 @@
  #include <stdio.h>
  #include <stdlib.h>
  #include <string.h>
+ #include <stdint.h>
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ /** @defgroup Binary roster format
+  * @{
+  */
+ #define ROSTER_MAGIC                        "SLRB"   /* First 4 bytes of a roster file */
+ #define ROSTER_VERSION                      (1U)
+ #define ROSTER_HEADER_SIZE                  (32U)    /* magic, version, record size, reserved, count, checksum */
+ #define ROSTER_NAME_SIZE                    (50U)    /* nameStudent, zero padded after the terminator */
+ #define ROSTER_RECORD_SIZE                  (ROSTER_NAME_SIZE + 8U) /* name, age (int32), GPA (float32 bits) */
+ /**
+  * @}
+  */
+ 
+ #define LIST_MAX_ORDER_KEYS                 (3U)     /* One key per Student field */
  
  /****************************************************************************** 
   * DEFINITIONS
@@ -44,17 +62,81 @@
   */
  typedef struct Node {
      Student dataStudent;   /* Student data stored in the node */
+     uint32_t orderLabel;   /* Grows along the list while a sorted index needs it, see LinkedList.c */
      struct Node *pNextNode; /* Pointer to the next node */
  } Node;
  
+ /**
+  * @brief Student field used as a sort key
+  */
+ typedef enum {
+     SORT_FIELD_NAME,               /* Sort by nameStudent */
+     SORT_FIELD_AGE,                /* Sort by ageStudent */
+     SORT_FIELD_GPA                 /* Sort by GPA */
+ } SortField_TypeDef;
+ 
+ /**
+  * @brief Direction of a sort key
+  */
+ typedef enum {
+     SORT_ASCENDING,                /* Smallest value first */
+     SORT_DESCENDING                /* Largest value first */
+ } SortDirection_TypeDef;
+ 
+ /**
+  * @brief One (field, direction) key of a multi-key sort
+  */
+ typedef struct SortKey {
+     SortField_TypeDef field;         /* Field to compare */
+     SortDirection_TypeDef direction; /* Ordering for this field */
+ } SortKey;
+ 
  /**
   * @brief Linked list structure
   */
  typedef struct LinkedList {
      Node *pHead;           /* Pointer to the head of the list */
      Node *pTail;           /* Pointer to the tail of the list */
+     int nodeCount;         /* Number of nodes in the list */
+     unsigned long changeCount;  /* Bumped by every mutation */
+     unsigned long reshapeCount; /* Bumped by every mutation except appends at the tail */
+     struct NameIndex *pNameIndex; /* Optional hash index on nameStudent, NULL if disabled */
+     struct PositionIndex *pPosIndex; /* Optional skip-list index on positions, NULL if disabled */
+     struct RangeIndex *pRangeIndex; /* Optional sorted index on age and GPA, NULL if disabled */
+     struct PrefixIndex *pPrefixIndex; /* Optional sorted index on nameStudent ignoring case, NULL if disabled */
+     SortKey orderKeys[LIST_MAX_ORDER_KEYS]; /* Order kept by every insert, see setMaintainedOrder */
+     int orderKeyCount;     /* Keys in orderKeys, 0 when no order is maintained */
  } LinkedList;
  
+ /**
+  * @brief Running checksum of roster record bytes
+  */
+ typedef struct RosterChecksum {
+     uint64_t sum;          /* Sum of the 32-bit words */
+     uint64_t sumOfSums;    /* Sum of the running sums, catches reordering */
+ } RosterChecksum;
+ 
+ /**
+  * @brief Slab of contiguous nodes owned by a node pool
+  */
+ typedef struct NodeSlab {
+     struct NodeSlab *pNextSlab; /* Next slab in the pool */
+     size_t capacity;            /* Number of nodes in this slab */
+     Node nodes[];               /* Node storage */
+ } NodeSlab;
+ 
+ /**
+  * @brief Node pool handing out nodes from large slabs
+  * @note  Free nodes are chained through their own pNextNode field
+  */
+ typedef struct NodePool {
+     NodeSlab *pSlabs;      /* List of allocated slabs */
+     Node *pFreeList;       /* Intrusive list of released nodes */
+     Node *pBump;           /* Next never-used node in the newest slab */
+     size_t bumpRemaining;  /* Never-used nodes left in the newest slab */
+     size_t nextSlabSize;   /* Capacity of the next slab to allocate */
+ } NodePool;
+ 
  /****************************************************************************** 
   * API
   ******************************************************************************/
@@ -64,6 +146,56 @@
   */
  void initLinkedList(LinkedList *pList);
  
+ /**
+  * @brief Initialize an empty node pool
+  * @param pPool Pointer to the node pool
+  */
+ void initNodePool(NodePool *pPool);
+ 
+ /**
+  * @brief Take a node from the pool, growing it by one slab if needed
+  * @param pPool Pointer to the node pool
+  * @return Pointer to an uninitialized node, or NULL if out of memory
+  */
+ Node* poolAllocNode(NodePool *pPool);
+ 
+ /**
+  * @brief Take a contiguous block of nodes from the pool
+  * @param pPool Pointer to the node pool
+  * @param count Number of nodes, at least 1
+  * @return Pointer to the first of count uninitialized nodes, or NULL if out of memory
+  * @note  The nodes can later be released one by one or as a chain
+  */
+ Node* poolAllocBlock(NodePool *pPool, size_t count);
+ 
+ /**
+  * @brief Return a single node to the pool
+  * @param pPool Pointer to the node pool
+  * @param pNode Node to release
+  */
+ void poolFreeNode(NodePool *pPool, Node *pNode);
+ 
+ /**
+  * @brief Return a whole linked chain of nodes to the pool in O(1)
+  * @param pPool Pointer to the node pool
+  * @param pFirst First node of the chain
+  * @param pLast Last node of the chain
+  */
+ void poolFreeChain(NodePool *pPool, Node *pFirst, Node *pLast);
+ 
+ /**
+  * @brief Release every slab of the pool back to the system
+  * @param pPool Pointer to the node pool
+  * @note  All nodes handed out by the pool become invalid
+  */
+ void destroyNodePool(NodePool *pPool);
+ 
+ /**
+  * @brief Get the pool used by createNode and the delete functions
+  * @return Pointer to the default node pool
+  */
+ NodePool* getDefaultNodePool(void);
+ 
  /**
   * @brief Create a new node with the given student data
   * @param student Student data to be stored in the node
@@ -75,6 +207,7 @@
   * @brief Add a node to the head of the linked list
   * @param pList Pointer to the linked list
   * @param pNewNode Pointer to the new node
+  * @note  With a maintained order the node goes to its sorted place instead
   */
  void addHead(LinkedList *pList, Node *pNewNode);
  
@@ -82,6 +215,7 @@
   * @brief Add a node to the tail of the linked list
   * @param pList Pointer to the linked list
   * @param pNewNode Pointer to the new node
+  * @note  With a maintained order the node goes to its sorted place instead
   */
  void addTail(LinkedList *pList, Node *pNewNode);
  
@@ -90,6 +224,7 @@
   * @param pList Pointer to the linked list
   * @param newStudent New student data
   * @param nameTarget Name of the student to insert before
+  * @note  With a maintained order the student goes to its sorted place instead
   */
  void insertBeforeStudent(LinkedList *pList, Student newStudent, const char *nameTarget);
  
@@ -98,6 +233,7 @@
   * @param pList Pointer to the linked list
   * @param newStudent New student data
   * @param nameTarget Name of the student to insert after
+  * @note  With a maintained order the student goes to its sorted place instead
   */
  void insertAfterStudent(LinkedList *pList, Student newStudent, const char *nameTarget);
  
@@ -106,6 +242,8 @@
   * @param pList Pointer to the linked list
   * @param newStudent New student data
   * @param position Position to insert the student (1-based index)
+  * @note  With a maintained order the position is still checked, but a
+  *        valid one is ignored and the student goes to its sorted place
   */
  void insertSpecificPosition(LinkedList *pList, Student newStudent, int position);
  
@@ -164,12 +302,115 @@
   */
  void editSpecificPosition(LinkedList *pList, int position, Student newStudent);
  
+ /**
+  * @brief Append students from an array, linked in one contiguous block of nodes
+  * @param pList Pointer to the linked list
+  * @param pStudents Students in list order
+  * @param count Number of students
+  * @return 1 on success, 0 if out of memory (a message is printed and the list is unchanged)
+  * @note  One pool allocation and one linking pass instead of a createNode
+  *        and addTail per student
+  */
+ int buildListFromArray(LinkedList *pList, const Student *pStudents, size_t count);
+ 
+ /**
+  * @brief Move every node of a list to the tail of another one
+  * @param pDst List receiving the nodes
+  * @param pSrc List giving the nodes, empty afterwards
+  * @note  O(1) relink; enabled name indexes of pDst add the moved nodes, in O(moved)
+  */
+ void appendList(LinkedList *pDst, LinkedList *pSrc);
+ 
+ /**
+  * @brief Move every node of a list into another one at a specific position
+  * @param pDst List receiving the nodes
+  * @param pSrc List giving the nodes, empty afterwards
+  * @param position Position the first moved node lands on (1-based index)
+  * @note  O(1) relink once the position is reached; nothing is copied or allocated
+  */
+ void spliceList(LinkedList *pDst, LinkedList *pSrc, int position);
+ 
+ /**
+  * @brief Move the nodes from a specific position to the end to the tail of another list
+  * @param pList List to cut
+  * @param position Position of the first node to move (1-based index)
+  * @param pRest List receiving the nodes
+  * @note  O(1) relink once the position is reached; the moved count comes from nodeCount
+  */
+ void splitListAt(LinkedList *pList, int position, LinkedList *pRest);
+ 
 /**
  * @brief Free all nodes in the linked list
  * @param pList Pointer to the linked list
+ * @note  Nodes go back to the default pool in O(1); call
+ *        destroyNodePool(getDefaultNodePool()) to release the memory itself.
+ *        The name, position, range and prefix indexes, if enabled, are released as well,
+ *        and a maintained order is cleared.
  */
 void freeLinkedList(LinkedList *pList);
 
+ /**
+  * @brief Stable sort of the linked list by several keys in priority order
+  * @param pList Pointer to the linked list
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
+  * @note  Key values are packed once per node before sorting; nodes are relinked.
+  *        Keys without the name field are sorted by a linear-time radix sort.
+  *        With a maintained order, sorting by the same keys returns at once
+  *        and sorting by other keys makes them the maintained order.
+  */
+ void sortList(LinkedList *pList, const SortKey *keys, int nkeys);
+ 
+ /**
+  * @brief Stable sort of the linked list on several threads
+  * @param pList Pointer to the linked list
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
+  * @param threadCount Number of threads, 0 for one per hardware thread
+  * @note  The chain is cut into one contiguous part per thread, each part is
+  *        packed and stably sorted on its own thread, and the nodes are then
+  *        relinked by a k-way merge that prefers the earlier part on ties, so
+  *        the result is identical to a single-threaded sort. Threads get at
+  *        least 32768 nodes each; smaller lists are sorted on the caller.
+  */
+ void sortListParallel(LinkedList *pList, const SortKey *keys, int nkeys, int threadCount);
+ 
+ /**
+  * @brief Set the number of threads used by sortList and the sortBy functions
+  * @param threadCount Number of threads, 0 for one per hardware thread, 1 to sort serially (default)
+  */
+ void setSortThreadCount(int threadCount);
+ 
+ /**
+  * @brief Keep the list sorted by keys from now on
+  * @param pList Pointer to the linked list
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
+  * @return 1 on success, 0 if the keys are invalid (a message is printed)
+  * @note  The list is sorted once, only if the keys changed. Every insert
+  *        then lands on its sorted place, after equal students, through a
+  *        key descent of the positional index (enabled here) in O(log n).
+  *        Edits move the student when its key changes; bulk appends and
+  *        splices sort again.
+  */
+ int setMaintainedOrder(LinkedList *pList, const SortKey *keys, int nkeys);
+ 
+ /**
+  * @brief Stop keeping the list sorted; inserts go where they are asked again
+  * @param pList Pointer to the linked list
+  */
+ void clearMaintainedOrder(LinkedList *pList);
+ 
+ /**
+  * @brief Compare two students by a list of sort keys
+  * @param pA First student
+  * @param pB Second student
+  * @param keys Sort keys, most significant first
+  * @param nkeys Number of keys
+  * @return Negative if A sorts first, positive if B sorts first, 0 if equal
+  */
+ int compareStudentsByKeys(const Student *pA, const Student *pB, const SortKey *keys, int nkeys);
+ 
  /**
   * @brief Sort the linked list by name in ascending order
   * @param pList Pointer to the linked list
@@ -206,11 +447,185 @@ void freeLinkedList(LinkedList *pList);
   */
  void sortByAgeDesc(LinkedList *pList);
  
+ /**
+  * @brief Build a hash index on nameStudent and keep it updated on every change
+  * @param pList Pointer to the linked list
+  * @return 1 if the index is enabled, 0 if it could not be allocated
+  * @note  Name-targeted operations become O(1) on average while enabled
+  */
+ int enableNameIndex(LinkedList *pList);
+ 
+ /**
+  * @brief Drop the name index and go back to linear name scans
+  * @param pList Pointer to the linked list
+  */
+ void disableNameIndex(LinkedList *pList);
+ 
+ /**
+  * @brief Build a skip-list index over the chain for O(log n) positional access
+  * @param pList Pointer to the linked list
+  * @return 1 if the index is enabled, 0 if it could not be allocated
+  * @note  Head, tail and positional operations keep it updated; name-targeted
+  *        operations and sorts mark it stale and it is rebuilt on next use
+  */
+ int enablePositionIndex(LinkedList *pList);
+ 
+ /**
+  * @brief Drop the positional index and go back to walking from the head
+  * @param pList Pointer to the linked list
+  */
+ void disablePositionIndex(LinkedList *pList);
+ 
+ /**
+  * @brief Keep node pointers sorted by age and by GPA for rangeByAge and rangeByGPA
+  * @param pList Pointer to the linked list
+  * @return 1 if the index is enabled, 0 if it could not be allocated
+  * @note  Sorted once here, then kept in step node by node by every change;
+  *        loads and sorts re-sort it
+  */
+ int enableRangeIndex(LinkedList *pList);
+ 
+ /**
+  * @brief Drop the range index and go back to scanning the list
+  * @param pList Pointer to the linked list
+  */
+ void disableRangeIndex(LinkedList *pList);
+ 
+ /**
+  * @brief Keep node pointers sorted by name, ignoring case, for searchStudentsByName
+  * @param pList Pointer to the linked list
+  * @return 1 if the index is enabled, 0 if it could not be allocated
+  * @note  Sorted once here, then kept in step node by node by every insert,
+  *        delete, rename, append, splice and batch; loads and sorts re-sort
+  *        it. Namesakes stay in list order, broken by the order labels.
+  */
+ int enablePrefixIndex(LinkedList *pList);
+ 
+ /**
+  * @brief Drop the prefix index and go back to scanning the list
+  * @param pList Pointer to the linked list
+  */
+ void disablePrefixIndex(LinkedList *pList);
+ 
+ /**
+  * @brief Find the first student with a specific name
+  * @param pList Pointer to the linked list
+  * @param name Name to look for
+  * @return Node of the student, or NULL if no student has this name
+  */
+ Node* findStudentByName(LinkedList *pList, const char *name);
+ 
+ /**
+  * @brief Find the student at a specific position
+  * @param pList Pointer to the linked list
+  * @param position Position (1-based index)
+  * @return Node at that position, or NULL if it is out of range
+  */
+ Node* findStudentAt(LinkedList *pList, int position);
+ 
  /**
   * @brief Count the number of nodes in the linked list
   * @param pList Pointer to the linked list
   * @return Number of nodes in the list
+  * @note  O(1): returns the count kept up to date by every mutation
   */
  int countNodes(LinkedList *pList);
  
+ /**
+  * @brief Bring indexes and change counters up to date after the chain was relinked directly
+  * @param pList Pointer to the linked list, with pHead, pTail and nodeCount already set
+  * @note  For modules that rebuild the chain themselves instead of going
+  *        through the insert and delete functions. Nodes kept from before
+  *        must stay in their relative order; the caller takes deleted and
+  *        edited nodes out with unindexListNode first and enters new and
+  *        edited ones with indexListNode afterwards.
+  */
+ void noteListRelinked(LinkedList *pList);
+ 
+ /**
+  * @brief Take a node out of the sorted indexes before changing or freeing it directly
+  * @param pList Pointer to the linked list
+  * @param pNode Node of the list, not yet changed
+  * @note  Does nothing if the node is not indexed
+  */
+ void unindexListNode(LinkedList *pList, const Node *pNode);
+ 
+ /**
+  * @brief Enter a node in the sorted indexes after noteListRelinked
+  * @param pList Pointer to the linked list
+  * @param pNode Node linked or changed directly
+  * @note  Does nothing if the node is indexed already
+  */
+ void indexListNode(LinkedList *pList, Node *pNode);
+ 
+ /**
+  * @brief Save the list to a binary roster file
+  * @param pList Pointer to the linked list
+  * @param filename Name of the file to write
+  * @return 1 on success, 0 on failure (a message is printed)
+  * @note  Layout (little-endian): 32-byte header with magic "SLRB", version,
+  *        record size, record count and a checksum of the records, then one
+  *        58-byte record per student: name (50 bytes, zero padded), age
+  *        (int32) and GPA (float32)
+  */
+ int saveListBinary(LinkedList *pList, const char *filename);
+ 
+ /**
+  * @brief Replace the list with the contents of a binary roster file
+  * @param pList Pointer to the linked list
+  * @param filename Name of the file to read
+  * @return 1 on success, 0 on failure (a message is printed and the list is unchanged)
+  * @note  All nodes come from one pool block linked in a single pass; enabled
+  *        indexes are rebuilt
+  */
+ int loadListBinary(LinkedList *pList, const char *filename);
+ 
+ /**
+  * @brief Validate a roster file header
+  * @param pHeader ROSTER_HEADER_SIZE bytes read from the file
+  * @param pCount Receives the record count
+  * @param pChecksum Receives the stored checksum
+  * @return NULL if the header is valid, otherwise an error message
+  */
+ const char* checkRosterHeader(const unsigned char *pHeader, uint64_t *pCount, uint64_t *pChecksum);
+ 
+ /**
+  * @brief Add a chunk of record bytes to a roster checksum
+  * @param pChecksum Checksum to update, zero-initialized before the first chunk
+  * @param pBytes Record bytes
+  * @param size Number of bytes; a multiple of 4 except for the last chunk
+  */
+ void updateRosterChecksum(RosterChecksum *pChecksum, const unsigned char *pBytes, size_t size);
+ 
+ /**
+  * @brief Fold the checksum sums into the value stored in the header
+  * @param pChecksum Checksum to finish
+  * @return 64-bit checksum
+  */
+ uint64_t finishRosterChecksum(const RosterChecksum *pChecksum);
+ 
+ /**
+  * @brief Encode a student as a roster record
+  * @param pOut ROSTER_RECORD_SIZE bytes
+  * @param pStudent Student to encode
+  */
+ void packRosterRecord(unsigned char *pOut, const Student *pStudent);
+ 
+ /**
+  * @brief Decode a roster record
+  * @param pRecord ROSTER_RECORD_SIZE bytes
+  * @param pStudent Receives the student
+  * @return 1 on success, 0 if the name is not terminated
+  */
+ int unpackRosterRecord(const unsigned char *pRecord, Student *pStudent);
+ 
+ #ifndef NDEBUG
+ /**
+  * @brief Walk the list and check the stored count and tail against it (debug builds)
+  * @param pList Pointer to the linked list
+  * @return 1 if consistent, 0 otherwise (the mismatch is printed)
+  */
+ int checkListConsistency(LinkedList *pList);
+ #endif
+ 
  #endif /* LINKEDLIST_H */
\ No newline at end of file
@@ -0,0 +1,701 @@
+/**
+ ******************************************************************************
+ * @file    listbatch.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of batched linked list mutations
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include "ListBatch.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define BATCH_NONE                          ((size_t)-1) /* End of an item chain */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Node inserted by the batch, kept after the original node it follows
+  */
+ typedef struct BatchAdded {
+     Node *pNode;                   /* Inserted node */
+     size_t group;                  /* Position (0-based) of the original node it follows */
+     struct BatchAdded *pNext;      /* Next inserted node of the same group, in list order */
+ } BatchAdded;
+ 
+ /**
+  * @brief Live student carrying one of the target names of the batch
+  */
+ typedef struct BatchItem {
+     size_t group;                  /* Position (0-based) of the original node */
+     BatchAdded *pAdded;            /* Inserted node, NULL for the original node itself */
+     size_t next;                   /* Next item with the same name, BATCH_NONE at the end */
+ } BatchItem;
+ 
+ /**
+  * @brief Hash slot of a target name
+  */
+ typedef struct BatchName {
+     const char *name;              /* Target name, NULL for an empty slot */
+     size_t first;                  /* First item with this name, in no particular order */
+ } BatchName;
+ 
+ /**
+  * @brief Hash slot of the inserted nodes following one original node
+  */
+ typedef struct BatchChain {
+     size_t key;                    /* group + 1, 0 for an empty slot */
+     BatchAdded *pFirst;            /* First inserted node of the group */
+ } BatchChain;
+ 
+ /**
+  * @brief Working state of one batch
+  * @note  The original nodes are the groups. Each group holds its original
+  *        node while alive, then the nodes inserted after it, so the list is
+  *        the groups in order. A Fenwick tree over the group sizes turns a
+  *        position into a group and a group into a position in O(log n).
+  */
+ typedef struct BatchState {
+     Node **pNodes;                 /* Original nodes by position, NULL once deleted */
+     int *pTree;                    /* Fenwick tree of group sizes, 1-based */
+     size_t groups;                 /* Number of original nodes */
+     size_t treeTop;                /* Largest power of two <= groups */
+     int total;                     /* Live students */
+     BatchName *pNames;             /* Open-addressed set of target names */
+     size_t nameMask;               /* Slot count - 1 */
+     BatchItem *pItems;             /* Items of the target names */
+     size_t itemCount;              /* Items handed out from pItems */
+     size_t itemCapacity;           /* Size of pItems */
+     size_t freeItem;               /* Released items, chained through next */
+     BatchChain *pChains;           /* Open-addressed map from group to inserted nodes */
+     size_t chainMask;              /* Slot count - 1 */
+     BatchAdded *pAdded;            /* Inserted nodes, one per insert op at most, pNode NULL once deleted */
+     size_t addedCount;             /* Entries used in pAdded */
+     size_t *pEdited;               /* Groups whose original node was edited, one per edit op at most */
+     size_t editedCount;            /* Entries used in pEdited */
+     LinkedList *pList;             /* List the batch applies to */
+ } BatchState;
+ 
+ /**
+  * @brief Reference to a live student
+  */
+ typedef struct BatchRef {
+     size_t group;                  /* Group of the student */
+     BatchAdded *pAdded;            /* Inserted node, NULL for the original node */
+ } BatchRef;
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Get the name of a batch status
+  * @param status Status to name
+  * @return Constant string such as "NOT_FOUND"
+  */
+ const char* batchStatusName(BatchStatus_TypeDef status) {
+     switch (status) {
+         case BATCH_OK:               return "OK";
+         case BATCH_NOT_FOUND:        return "NOT_FOUND";
+         case BATCH_NO_NEXT:          return "NO_NEXT";
+         case BATCH_INVALID_POSITION: return "INVALID_POSITION";
+         case BATCH_OUT_OF_RANGE:     return "OUT_OF_RANGE";
+         case BATCH_INVALID_OP:       return "INVALID_OP";
+         default:                     return "UNKNOWN";
+     }
+ }
+ 
+ /**
+  * @brief FNV-1a hash of a name
+  * @param name Null-terminated name
+  * @return 32-bit hash
+  */
+ static uint32_t hashName(const char *name) {
+     uint32_t hash = 2166136261U;
+     while (*name != '\0') {
+         hash ^= (unsigned char)*name++;
+         hash *= 16777619U;
+     }
+     return hash;
+ }
+ 
+ /**
+  * @brief Smallest power of two holding twice the given number of entries
+  * @param entries Number of entries
+  * @return Slot count
+  */
+ static size_t tableSize(size_t entries) {
+     size_t size = 2;
+     while (size < entries * 2) size <<= 1;
+     return size;
+ }
+ 
+ /**
+  * @brief Find the slot of a name or the empty slot where it would go
+  * @param pState Batch state
+  * @param name Name to look up
+  * @return Slot
+  */
+ static BatchName* nameSlot(BatchState *pState, const char *name) {
+     size_t slot = hashName(name) & pState->nameMask;
+     while (pState->pNames[slot].name != NULL && strcmp(pState->pNames[slot].name, name) != 0) {
+         slot = (slot + 1) & pState->nameMask;
+     }
+     return &pState->pNames[slot];
+ }
+ 
+ /**
+  * @brief Find a target name
+  * @param pState Batch state
+  * @param name Name to look up
+  * @return Slot of the name, or NULL if no op targets it
+  */
+ static BatchName* findName(BatchState *pState, const char *name) {
+     BatchName *pSlot = nameSlot(pState, name);
+     return (pSlot->name != NULL) ? pSlot : NULL;
+ }
+ 
+ /**
+  * @brief Find the slot of a group or the empty slot where it would go
+  * @param pState Batch state
+  * @param group Group to look up
+  * @return Slot
+  */
+ static BatchChain* chainSlot(BatchState *pState, size_t group) {
+     size_t slot = (group * 2654435761U) & pState->chainMask;
+     while (pState->pChains[slot].key != 0 && pState->pChains[slot].key != group + 1) {
+         slot = (slot + 1) & pState->chainMask;
+     }
+     return &pState->pChains[slot];
+ }
+ 
+ /**
+  * @brief Get the first node inserted after a group
+  * @param pState Batch state
+  * @param group Group
+  * @return First inserted node, or NULL if none
+  */
+ static BatchAdded* chainFirst(BatchState *pState, size_t group) {
+     return chainSlot(pState, group)->pFirst;
+ }
+ 
+ /**
+  * @brief Set the first node inserted after a group
+  * @param pState Batch state
+  * @param group Group
+  * @param pFirst New first inserted node, may be NULL
+  */
+ static void setChainFirst(BatchState *pState, size_t group, BatchAdded *pFirst) {
+     BatchChain *pSlot = chainSlot(pState, group);
+     pSlot->key = group + 1; /* Slots are never removed, an emptied group keeps its slot */
+     pSlot->pFirst = pFirst;
+ }
+ 
+ /**
+  * @brief Take an item, growing the item array if needed
+  * @param pState Batch state
+  * @return Item index, or BATCH_NONE if out of memory
+  * @note  Only grows while the chain is scanned; room for every op is
+  *        reserved before the first mutation
+  */
+ static size_t allocItem(BatchState *pState) {
+     size_t item = pState->freeItem;
+     if (item != BATCH_NONE) {
+         pState->freeItem = pState->pItems[item].next;
+         return item;
+     }
+     if (pState->itemCount == pState->itemCapacity) {
+         size_t capacity = (pState->itemCapacity != 0) ? pState->itemCapacity * 2 : 64;
+         BatchItem *pItems = (BatchItem*)realloc(pState->pItems, capacity * sizeof(BatchItem));
+         if (pItems == NULL) return BATCH_NONE;
+         pState->pItems = pItems;
+         pState->itemCapacity = capacity;
+     }
+     return pState->itemCount++;
+ }
+ 
+ /**
+  * @brief Record that a student carries a target name
+  * @param pState Batch state
+  * @param pName Slot of the name
+  * @param ref Student
+  * @return 1 on success, 0 if out of memory
+  */
+ static int addItem(BatchState *pState, BatchName *pName, BatchRef ref) {
+     size_t item = allocItem(pState);
+     if (item == BATCH_NONE) return 0;
+     pState->pItems[item].group = ref.group;
+     pState->pItems[item].pAdded = ref.pAdded;
+     pState->pItems[item].next = pName->first;
+     pName->first = item;
+     return 1;
+ }
+ 
+ /**
+  * @brief Forget that a student carries a target name
+  * @param pState Batch state
+  * @param pName Slot of the name
+  * @param ref Student
+  */
+ static void removeItem(BatchState *pState, BatchName *pName, BatchRef ref) {
+     size_t *pLink = &pName->first;
+     while (*pLink != BATCH_NONE) {
+         BatchItem *pItem = &pState->pItems[*pLink];
+         if (pItem->group == ref.group && pItem->pAdded == ref.pAdded) {
+             size_t item = *pLink;
+             *pLink = pItem->next;
+             pItem->next = pState->freeItem;
+             pState->freeItem = item;
+             return;
+         }
+         pLink = &pItem->next;
+     }
+ }
+ 
+ /**
+  * @brief Get the node of a student
+  * @param pState Batch state
+  * @param ref Student
+  * @return Node
+  */
+ static Node* refNode(BatchState *pState, BatchRef ref) {
+     return (ref.pAdded != NULL) ? ref.pAdded->pNode : pState->pNodes[ref.group];
+ }
+ 
+ /**
+  * @brief Change the size of a group
+  * @param pState Batch state
+  * @param group Group
+  * @param delta +1 or -1
+  */
+ static void treeAdd(BatchState *pState, size_t group, int delta) {
+     for (size_t i = group + 1; i <= pState->groups; i += i & (~i + 1)) pState->pTree[i] += delta;
+     pState->total += delta;
+ }
+ 
+ /**
+  * @brief Count the students in the groups before a group
+  * @param pState Batch state
+  * @param group Group
+  * @return Number of students
+  */
+ static int treePrefix(BatchState *pState, size_t group) {
+     int sum = 0;
+     for (size_t i = group; i > 0; i -= i & (~i + 1)) sum += pState->pTree[i];
+     return sum;
+ }
+ 
+ /**
+  * @brief Find the student at a position
+  * @param pState Batch state
+  * @param position Position (1-based index), at most total
+  * @return Student
+  */
+ static BatchRef refAt(BatchState *pState, int position) {
+     BatchRef ref;
+     size_t pos = 0;
+     int remaining = position;
+     for (size_t step = pState->treeTop; step > 0; step >>= 1) { /* Descend to the group holding it */
+         if (pos + step <= pState->groups && pState->pTree[pos + step] < remaining) {
+             pos += step;
+             remaining -= pState->pTree[pos];
+         }
+     }
+     ref.group = pos;
+     ref.pAdded = NULL;
+     if (pState->pNodes[pos] != NULL && --remaining == 0) return ref;
+     ref.pAdded = chainFirst(pState, pos);
+     while (--remaining > 0) ref.pAdded = ref.pAdded->pNext;
+     return ref;
+ }
+ 
+ /**
+  * @brief Find the position of a student
+  * @param pState Batch state
+  * @param ref Student
+  * @return Position (1-based index)
+  */
+ static int positionOf(BatchState *pState, BatchRef ref) {
+     int position = treePrefix(pState, ref.group) + 1;
+     if (ref.pAdded == NULL) return position;
+     if (pState->pNodes[ref.group] != NULL) position++;
+     for (BatchAdded *pAdded = chainFirst(pState, ref.group); pAdded != ref.pAdded; pAdded = pAdded->pNext) position++;
+     return position;
+ }
+ 
+ /**
+  * @brief Check whether a student comes before another one
+  * @param a First student
+  * @param b Second student, a different one
+  * @return 1 if a is first, 0 otherwise
+  */
+ static int comesBefore(BatchRef a, BatchRef b) {
+     if (a.group != b.group) return a.group < b.group;
+     if (a.pAdded == NULL || b.pAdded == NULL) return a.pAdded == NULL; /* Original node leads its group */
+     for (BatchAdded *pAdded = a.pAdded->pNext; pAdded != NULL; pAdded = pAdded->pNext) {
+         if (pAdded == b.pAdded) return 1;
+     }
+     return 0;
+ }
+ 
+ /**
+  * @brief Find the first student with a target name, like findStudentByName
+  * @param pState Batch state
+  * @param name Target name
+  * @param pRef Receives the student
+  * @return 1 if found, 0 otherwise
+  */
+ static int firstByName(BatchState *pState, const char *name, BatchRef *pRef) {
+     BatchName *pName = findName(pState, name);
+     int found = 0;
+     if (pName == NULL) return 0;
+     for (size_t item = pName->first; item != BATCH_NONE; item = pState->pItems[item].next) {
+         BatchRef ref = { pState->pItems[item].group, pState->pItems[item].pAdded };
+         if (!found || comesBefore(ref, *pRef)) *pRef = ref;
+         found = 1;
+     }
+     return found;
+ }
+ 
+ /**
+  * @brief Apply a BATCH_INSERT_AFTER op
+  * @param pState Batch state
+  * @param pOp Op
+  * @return Status of the op
+  */
+ static BatchStatus_TypeDef batchInsertAfter(BatchState *pState, const BatchOp *pOp) {
+     BatchRef target;
+     BatchRef ref;
+     BatchName *pName;
+     BatchAdded *pAdded;
+     if (!firstByName(pState, pOp->nameTarget, &target)) return BATCH_NOT_FOUND;
+     pAdded = &pState->pAdded[pState->addedCount++];
+     pAdded->pNode = createNode(pOp->student);
+     pAdded->group = target.group;
+     if (target.pAdded == NULL) { /* Right after the original node: head of the group's chain */
+         pAdded->pNext = chainFirst(pState, target.group);
+         setChainFirst(pState, target.group, pAdded);
+     } else {
+         pAdded->pNext = target.pAdded->pNext;
+         target.pAdded->pNext = pAdded;
+     }
+     treeAdd(pState, target.group, 1);
+     pName = findName(pState, pOp->student.nameStudent);
+     ref.group = target.group;
+     ref.pAdded = pAdded;
+     if (pName != NULL) addItem(pState, pName, ref); /* Room reserved up front */
+     return BATCH_OK;
+ }
+ 
+ /**
+  * @brief Apply a BATCH_DELETE_AFTER op
+  * @param pState Batch state
+  * @param pOp Op
+  * @return Status of the op
+  */
+ static BatchStatus_TypeDef batchDeleteAfter(BatchState *pState, const BatchOp *pOp) {
+     BatchRef target;
+     BatchRef victim;
+     BatchName *pName;
+     int position;
+     if (!firstByName(pState, pOp->nameTarget, &target)) return BATCH_NOT_FOUND;
+     position = positionOf(pState, target);
+     if (position == pState->total) return BATCH_NO_NEXT;
+     victim = refAt(pState, position + 1);
+     pName = findName(pState, refNode(pState, victim)->dataStudent.nameStudent);
+     if (pName != NULL) removeItem(pState, pName, victim);
+     if (victim.pAdded == NULL) {
+         unindexListNode(pState->pList, pState->pNodes[victim.group]);
+         poolFreeNode(getDefaultNodePool(), pState->pNodes[victim.group]);
+         pState->pNodes[victim.group] = NULL;
+     } else {
+         BatchAdded *pFirst = chainFirst(pState, victim.group);
+         if (pFirst == victim.pAdded) {
+             setChainFirst(pState, victim.group, victim.pAdded->pNext);
+         } else {
+             while (pFirst->pNext != victim.pAdded) pFirst = pFirst->pNext;
+             pFirst->pNext = victim.pAdded->pNext;
+         }
+         poolFreeNode(getDefaultNodePool(), victim.pAdded->pNode);
+         victim.pAdded->pNode = NULL;
+     }
+     treeAdd(pState, victim.group, -1);
+     return BATCH_OK;
+ }
+ 
+ /**
+  * @brief Apply a BATCH_EDIT_POSITION op
+  * @param pState Batch state
+  * @param pOp Op
+  * @return Status of the op
+  */
+ static BatchStatus_TypeDef batchEditPosition(BatchState *pState, const BatchOp *pOp) {
+     BatchRef ref;
+     BatchName *pName;
+     Node *pNode;
+     if (pOp->position < 1) return BATCH_INVALID_POSITION;
+     if (pOp->position > pState->total) return BATCH_OUT_OF_RANGE;
+     ref = refAt(pState, pOp->position);
+     pNode = refNode(pState, ref);
+     pName = findName(pState, pNode->dataStudent.nameStudent);
+     if (pName != NULL) removeItem(pState, pName, ref);
+     if (ref.pAdded == NULL) { /* Inserted nodes are indexed once the batch is linked */
+         unindexListNode(pState->pList, pNode);
+         pState->pEdited[pState->editedCount++] = ref.group;
+     }
+     pNode->dataStudent = pOp->student;
+     pName = findName(pState, pNode->dataStudent.nameStudent);
+     if (pName != NULL) addItem(pState, pName, ref); /* Reuses the item just released */
+     return BATCH_OK;
+ }
+ 
+ /**
+  * @brief Order chain slots by group
+  * @param pA First slot
+  * @param pB Second slot
+  * @return Negative, zero or positive as for qsort
+  */
+ static int compareChains(const void *pA, const void *pB) {
+     size_t a = ((const BatchChain*)pA)->key;
+     size_t b = ((const BatchChain*)pB)->key;
+     return (a > b) - (a < b);
+ }
+ 
+ /**
+  * @brief Link the groups back into one chain
+  * @param pState Batch state
+  * @param pList Pointer to the linked list
+  */
+ static void relinkGroups(BatchState *pState, LinkedList *pList) {
+     BatchChain *pChains = pState->pChains;
+     size_t chainCount = 0;
+     size_t nextChain = 0;
+     Node *pPrev = NULL;
+     for (size_t slot = 0; slot <= pState->chainMask; slot++) { /* Compact the used slots, then sort them */
+         if (pChains[slot].pFirst != NULL) pChains[chainCount++] = pChains[slot];
+     }
+     qsort(pChains, chainCount, sizeof(BatchChain), compareChains);
+     pList->pHead = NULL;
+     for (size_t group = 0; group < pState->groups; group++) {
+         BatchAdded *pAdded = NULL;
+         if (nextChain < chainCount && pChains[nextChain].key == group + 1) pAdded = pChains[nextChain++].pFirst;
+         if (pState->pNodes[group] != NULL) {
+             if (pPrev == NULL) pList->pHead = pState->pNodes[group];
+             else pPrev->pNextNode = pState->pNodes[group];
+             pPrev = pState->pNodes[group];
+         }
+         for (; pAdded != NULL; pAdded = pAdded->pNext) {
+             if (pPrev == NULL) pList->pHead = pAdded->pNode;
+             else pPrev->pNextNode = pAdded->pNode;
+             pPrev = pAdded->pNode;
+         }
+     }
+     if (pPrev != NULL) pPrev->pNextNode = NULL;
+     pList->pTail = pPrev;
+     pList->nodeCount = pState->total;
+ }
+ 
+ /**
+  * @brief Release the working state of a batch
+  * @param pState Batch state
+  */
+ static void freeBatchState(BatchState *pState) {
+     free(pState->pNodes);
+     free(pState->pTree);
+     free(pState->pNames);
+     free(pState->pItems);
+     free(pState->pChains);
+     free(pState->pAdded);
+     free(pState->pEdited);
+ }
+ 
+ /**
+  * @brief Enter the inserted and edited nodes in the sorted indexes once the batch is linked
+  * @param pState Batch state
+  */
+ static void indexBatchNodes(BatchState *pState) {
+     for (size_t i = 0; i < pState->addedCount; i++) {
+         if (pState->pAdded[i].pNode != NULL) indexListNode(pState->pList, pState->pAdded[i].pNode);
+     }
+     for (size_t i = 0; i < pState->editedCount; i++) {
+         Node *pNode = pState->pNodes[pState->pEdited[i]];
+         if (pNode != NULL) indexListNode(pState->pList, pNode); /* NULL if deleted later in the batch */
+     }
+ }
+ 
+ /**
+  * @brief Collect the target names and the original nodes, in one walk of the chain
+  * @param pState Batch state, zeroed
+  * @param pList Pointer to the linked list
+  * @param pOps Mutations
+  * @param count Number of mutations
+  * @return 1 on success, 0 if out of memory
+  */
+ static int prepareBatch(BatchState *pState, LinkedList *pList, const BatchOp *pOps, size_t count) {
+     size_t named = 0;
+     size_t inserts = 0;
+     size_t edits = 0;
+     size_t group = 0;
+     for (size_t i = 0; i < count; i++) {
+         if (pOps[i].kind == BATCH_INSERT_AFTER) inserts++;
+         if (pOps[i].kind == BATCH_EDIT_POSITION) edits++;
+         if (pOps[i].kind == BATCH_INSERT_AFTER || pOps[i].kind == BATCH_DELETE_AFTER) named++;
+     }
+     pState->pList = pList;
+     pState->groups = (size_t)pList->nodeCount;
+     pState->freeItem = BATCH_NONE;
+     pState->nameMask = tableSize(named) - 1;
+     pState->chainMask = tableSize(inserts) - 1;
+     pState->pNodes = (Node**)malloc((pState->groups + 1) * sizeof(Node*));
+     pState->pTree = (int*)malloc((pState->groups + 1) * sizeof(int));
+     pState->pNames = (BatchName*)calloc(pState->nameMask + 1, sizeof(BatchName));
+     pState->pChains = (BatchChain*)calloc(pState->chainMask + 1, sizeof(BatchChain));
+     pState->pAdded = (BatchAdded*)malloc((inserts + 1) * sizeof(BatchAdded));
+     pState->pEdited = (size_t*)malloc((edits + 1) * sizeof(size_t));
+     if (pState->pNodes == NULL || pState->pTree == NULL || pState->pNames == NULL
+         || pState->pChains == NULL || pState->pAdded == NULL || pState->pEdited == NULL) return 0;
+     for (size_t i = 0; i < count; i++) {
+         if ((pOps[i].kind == BATCH_INSERT_AFTER || pOps[i].kind == BATCH_DELETE_AFTER) && pOps[i].nameTarget != NULL) {
+             BatchName *pSlot = nameSlot(pState, pOps[i].nameTarget);
+             if (pSlot->name == NULL) {
+                 pSlot->name = pOps[i].nameTarget;
+                 pSlot->first = BATCH_NONE;
+             }
+         }
+     }
+     pState->treeTop = 1;
+     while (pState->treeTop * 2 <= pState->groups) pState->treeTop *= 2;
+     for (Node *current = pList->pHead; current != NULL; current = current->pNextNode, group++) {
+         BatchName *pName = (named != 0) ? findName(pState, current->dataStudent.nameStudent) : NULL;
+         pState->pNodes[group] = current;
+         pState->pTree[group + 1] = (int)((group + 1) & (~(group + 1) + 1)); /* Every group starts with one student */
+         if (pName != NULL) {
+             BatchRef ref = { group, NULL };
+             if (!addItem(pState, pName, ref)) return 0;
+         }
+     }
+     pState->total = (int)pState->groups;
+     if (pState->itemCapacity < pState->itemCount + count) { /* Each op adds at most one item */
+         BatchItem *pItems = (BatchItem*)realloc(pState->pItems, (pState->itemCount + count) * sizeof(BatchItem));
+         if (pItems == NULL) return 0;
+         pState->pItems = pItems;
+         pState->itemCapacity = pState->itemCount + count;
+     }
+     return 1;
+ }
+ 
+ /**
+  * @brief Apply a batch one mutation at a time, for a list with a maintained order
+  * @param pList Pointer to the linked list, with orderKeyCount > 0
+  * @param pOps Mutations
+  * @param count Number of mutations
+  * @param pStatus Receives the outcome of each mutation, may be NULL
+  * @return Number of mutations applied
+  * @note  Inserts and edits move students to their sorted place, so later
+  *        targets depend on the order after each mutation and the grouped
+  *        pass does not apply. Each status is checked first so the
+  *        single-mutation functions print nothing.
+  */
+ static int applyBatchInOrder(LinkedList *pList, const BatchOp *pOps, size_t count, BatchStatus_TypeDef *pStatus) {
+     int applied = 0;
+     for (size_t i = 0; i < count; i++) {
+         const BatchOp *pOp = &pOps[i];
+         BatchStatus_TypeDef status = BATCH_OK;
+         Node *pTarget = NULL;
+         switch (pOp->kind) {
+             case BATCH_INSERT_AFTER:
+             case BATCH_DELETE_AFTER:
+                 if (pOp->nameTarget == NULL) {
+                     status = BATCH_INVALID_OP;
+                     break;
+                 }
+                 pTarget = findStudentByName(pList, pOp->nameTarget);
+                 if (pTarget == NULL) {
+                     status = BATCH_NOT_FOUND;
+                 } else if (pOp->kind == BATCH_INSERT_AFTER) {
+                     insertAfterStudent(pList, pOp->student, pOp->nameTarget);
+                 } else if (pTarget->pNextNode == NULL) {
+                     status = BATCH_NO_NEXT;
+                 } else {
+                     deleteAfterStudent(pList, pOp->nameTarget);
+                 }
+                 break;
+             case BATCH_EDIT_POSITION:
+                 if (pOp->position < 1) {
+                     status = BATCH_INVALID_POSITION;
+                 } else if (pOp->position > pList->nodeCount) {
+                     status = BATCH_OUT_OF_RANGE;
+                 } else {
+                     editSpecificPosition(pList, pOp->position, pOp->student);
+                 }
+                 break;
+             default:
+                 status = BATCH_INVALID_OP;
+                 break;
+         }
+         if (status == BATCH_OK) applied++;
+         if (pStatus != NULL) pStatus[i] = status;
+     }
+     return applied;
+ }
+ 
+ /**
+  * @brief Apply a batch of mutations in order, walking the chain once
+  * @param pList Pointer to the linked list
+  * @param pOps Mutations, applied as if one at a time in array order
+  * @param count Number of mutations
+  * @param pStatus Receives the outcome of each mutation, may be NULL
+  * @return Number of mutations applied, or -1 if out of memory (the list is unchanged)
+  */
+ int applyBatch(LinkedList *pList, const BatchOp *pOps, size_t count, BatchStatus_TypeDef *pStatus) {
+     BatchState state;
+     int applied = 0;
+     if (pList->orderKeyCount > 0) return applyBatchInOrder(pList, pOps, count, pStatus);
+     memset(&state, 0, sizeof(state));
+     if (!prepareBatch(&state, pList, pOps, count)) {
+         printf("Memory allocation failed!\n");
+         freeBatchState(&state);
+         return -1;
+     }
+     for (size_t i = 0; i < count; i++) {
+         BatchStatus_TypeDef status;
+         switch (pOps[i].kind) {
+             case BATCH_INSERT_AFTER:
+                 status = (pOps[i].nameTarget != NULL) ? batchInsertAfter(&state, &pOps[i]) : BATCH_INVALID_OP;
+                 break;
+             case BATCH_DELETE_AFTER:
+                 status = (pOps[i].nameTarget != NULL) ? batchDeleteAfter(&state, &pOps[i]) : BATCH_INVALID_OP;
+                 break;
+             case BATCH_EDIT_POSITION:
+                 status = batchEditPosition(&state, &pOps[i]);
+                 break;
+             default:
+                 status = BATCH_INVALID_OP;
+                 break;
+         }
+         if (status == BATCH_OK) applied++;
+         if (pStatus != NULL) pStatus[i] = status;
+     }
+     if (applied != 0) {
+         relinkGroups(&state, pList);
+         noteListRelinked(pList);
+         indexBatchNodes(&state);
+     }
+     freeBatchState(&state);
+     return applied;
+ }
@@ -0,0 +1,89 @@
+/**
+ ******************************************************************************
+ * @file    listbatch.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for batched linked list mutations
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef LISTBATCH_H
+ #define LISTBATCH_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include "linkedlist.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Kind of a batched mutation
+  */
+ typedef enum {
+     BATCH_INSERT_AFTER,            /* Like insertAfterStudent(student, nameTarget) */
+     BATCH_DELETE_AFTER,            /* Like deleteAfterStudent(nameTarget) */
+     BATCH_EDIT_POSITION            /* Like editSpecificPosition(position, student) */
+ } BatchOpKind_TypeDef;
+ 
+ /**
+  * @brief Outcome of one batched mutation
+  */
+ typedef enum {
+     BATCH_OK,                      /* Applied */
+     BATCH_NOT_FOUND,               /* No student named nameTarget */
+     BATCH_NO_NEXT,                 /* nameTarget is the last student, nothing to delete */
+     BATCH_INVALID_POSITION,        /* position < 1 */
+     BATCH_OUT_OF_RANGE,            /* position > number of students */
+     BATCH_INVALID_OP               /* Unknown kind or NULL nameTarget */
+ } BatchStatus_TypeDef;
+ 
+ /**
+  * @brief One mutation of a batch
+  */
+ typedef struct BatchOp {
+     BatchOpKind_TypeDef kind;      /* What to do */
+     const char *nameTarget;        /* Target name for BATCH_INSERT_AFTER and BATCH_DELETE_AFTER */
+     int position;                  /* Target position for BATCH_EDIT_POSITION (1-based index) */
+     Student student;               /* New data for BATCH_INSERT_AFTER and BATCH_EDIT_POSITION */
+ } BatchOp;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Apply a batch of mutations in order, walking the chain once
+  * @param pList Pointer to the linked list
+  * @param pOps Mutations, applied as if one at a time in array order
+  * @param count Number of mutations
+  * @param pStatus Receives the outcome of each mutation, may be NULL
+  * @return Number of mutations applied, or -1 if out of memory (the list is unchanged)
+  * @note  Nothing is printed per mutation. Targets are resolved against an
+  *        order-statistics tree over the original positions, so the cost is
+  *        O(n + k log n) instead of one scan from the head per mutation.
+  *        The final list, including which duplicate a name resolves to, is
+  *        the same as calling the single-mutation functions in order.
+  *        With a maintained order the mutations are applied one at a time
+  *        through those functions instead, O(k n)
+  */
+ int applyBatch(LinkedList *pList, const BatchOp *pOps, size_t count, BatchStatus_TypeDef *pStatus);
+ 
+ /**
+  * @brief Get the name of a batch status
+  * @param status Status to name
+  * @return Constant string such as "NOT_FOUND"
+  */
+ const char* batchStatusName(BatchStatus_TypeDef status);
+ 
+ #endif /* LISTBATCH_H */
@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @file    mpsclist.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of the lock-free append-only student log
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include "MpscList.h"
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Initialize the log
+  * @param pList Pointer to the log
+  */
+ void initMpscList(MpscList *pList) {
+     memset(&pList->stub.dataStudent, 0, sizeof(pList->stub.dataStudent));
+     atomic_init(&pList->stub.pNextNode, NULL);
+     pList->pHead = &pList->stub;
+     atomic_init(&pList->pTail, &pList->stub);
+ }
+ 
+ /**
+  * @brief Free every student still in the log
+  * @param pList Pointer to the log
+  */
+ void mFreeList(MpscList *pList) {
+     while (mDeleteHead(pList, NULL));
+ }
+ 
+ /**
+  * @brief Create a log node
+  * @param student Student data
+  * @return Pointer to the new node, NULL if out of memory
+  */
+ MNode* createMNode(Student student) {
+     MNode *pNode = (MNode*)malloc(sizeof(MNode));
+     if (pNode == NULL) {
+         printf("Memory allocation failed!\n");
+         return NULL;
+     }
+     pNode->dataStudent = student;
+     atomic_init(&pNode->pNextNode, NULL);
+     return pNode;
+ }
+ 
+ /**
+  * @brief Append a node at the tail of the log; safe from any number of threads
+  * @param pList Pointer to the log
+  * @param pNewNode Node from createMNode, owned by the log afterwards
+  */
+ void mAddTailNode(MpscList *pList, MNode *pNewNode) {
+     MNode *pPrev;
+     atomic_store_explicit(&pNewNode->pNextNode, NULL, memory_order_relaxed);
+     pPrev = atomic_exchange_explicit(&pList->pTail, pNewNode, memory_order_acq_rel); /* Claim the last place */
+     atomic_store_explicit(&pPrev->pNextNode, pNewNode, memory_order_release); /* Make it reachable */
+ }
+ 
+ /**
+  * @brief Append a student at the tail of the log; safe from any number of threads
+  * @param pList Pointer to the log
+  * @param student Student data
+  * @return 1 on success, 0 if out of memory
+  */
+ int mAddTail(MpscList *pList, Student student) {
+     MNode *pNewNode = createMNode(student);
+     if (pNewNode == NULL) return 0;
+     mAddTailNode(pList, pNewNode);
+     return 1;
+ }
+ 
+ /**
+  * @brief Unlink the node at the head of the log
+  * @param pList Pointer to the log
+  * @return The node, or NULL if none can be taken now
+  */
+ static MNode* popHeadNode(MpscList *pList) {
+     MNode *pHead = pList->pHead;
+     MNode *pNext = atomic_load_explicit(&pHead->pNextNode, memory_order_acquire);
+     if (pHead == &pList->stub) { /* Step over the stub */
+         if (pNext == NULL) return NULL;
+         pList->pHead = pNext;
+         pHead = pNext;
+         pNext = atomic_load_explicit(&pHead->pNextNode, memory_order_acquire);
+     }
+     if (pNext != NULL) {
+         pList->pHead = pNext;
+         return pHead;
+     }
+     if (pHead != atomic_load_explicit(&pList->pTail, memory_order_acquire)) {
+         return NULL; /* A producer swapped pTail but hasn't linked its node yet */
+     }
+     mAddTailNode(pList, &pList->stub); /* pHead is last: queue the stub behind it */
+     pNext = atomic_load_explicit(&pHead->pNextNode, memory_order_acquire);
+     if (pNext != NULL) {
+         pList->pHead = pNext;
+         return pHead;
+     }
+     return NULL;
+ }
+ 
+ /**
+  * @brief Remove the student at the head of the log; consumer thread only
+  * @param pList Pointer to the log
+  * @param pOut Receives the student, may be NULL
+  * @return 1 if a student was removed, 0 if the log is empty
+  */
+ int mDeleteHead(MpscList *pList, Student *pOut) {
+     MNode *pNode = popHeadNode(pList);
+     if (pNode == NULL) return 0;
+     if (pOut != NULL) *pOut = pNode->dataStudent;
+     free(pNode); /* Taken only after its next link was set, so no producer still holds it */
+     return 1;
+ }
+ 
+ /**
+  * @brief Move every student currently in the log to the tail of a linked list
+  * @param pList Pointer to the log; consumer thread only
+  * @param pTarget Linked list to append to
+  * @return Number of students moved
+  */
+ int mDrainToList(MpscList *pList, LinkedList *pTarget) {
+     Student student;
+     int moved = 0;
+     while (mDeleteHead(pList, &student)) {
+         addTail(pTarget, createNode(student));
+         moved++;
+     }
+     return moved;
+ }
@@ -0,0 +1,121 @@
+/**
+ ******************************************************************************
+ * @file    mpsclist.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for the lock-free append-only student log
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef MPSCLIST_H
+ #define MPSCLIST_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include <stdatomic.h>
+ #include "linkedlist.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define MPSC_CACHE_LINE                     (64)   /* Cache line size assumed for padding */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Log node
+  */
+ typedef struct MNode {
+     Student dataStudent;                /* Student data stored in the node */
+     _Atomic(struct MNode*) pNextNode;   /* Pointer to the next node, set once by the producer */
+ } MNode;
+ 
+ /**
+  * @brief Multi-producer, single-consumer list of students
+  * @note  Producers only touch pTail: one atomic exchange claims the last
+  *        place and a store links the previous node to the new one, so an
+  *        append finishes in a bounded number of steps whatever the other
+  *        threads do. Only the consumer touches pHead. The stub node keeps
+  *        the chain non-empty so the two ends never share a pointer.
+  *        pTail starts a new cache line; a log allocated on the heap needs
+  *        aligned_alloc(MPSC_CACHE_LINE, ...) to keep that.
+  */
+ typedef struct MpscList {
+     MNode *pHead;                       /* Oldest node, owned by the consumer */
+     _Alignas(MPSC_CACHE_LINE) _Atomic(MNode*) pTail; /* Newest node, swapped by producers, on its own cache line */
+     MNode stub;                         /* Placeholder re-queued when the log runs empty */
+ } MpscList;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Initialize the log
+  * @param pList Pointer to the log
+  */
+ void initMpscList(MpscList *pList);
+ 
+ /**
+  * @brief Free every student still in the log
+  * @param pList Pointer to the log
+  * @note  No producer or consumer may use the log during or after this call
+  */
+ void mFreeList(MpscList *pList);
+ 
+ /**
+  * @brief Create a log node
+  * @param student Student data
+  * @return Pointer to the new node, NULL if out of memory
+  * @note  Lets a producer allocate ahead of time and keep mAddTailNode wait-free
+  */
+ MNode* createMNode(Student student);
+ 
+ /**
+  * @brief Append a node at the tail of the log; safe from any number of threads
+  * @param pList Pointer to the log
+  * @param pNewNode Node from createMNode, owned by the log afterwards
+  */
+ void mAddTailNode(MpscList *pList, MNode *pNewNode);
+ 
+ /**
+  * @brief Append a student at the tail of the log; safe from any number of threads
+  * @param pList Pointer to the log
+  * @param student Student data
+  * @return 1 on success, 0 if out of memory
+  * @note  Allocates with malloc; use createMNode and mAddTailNode to keep
+  *        allocation off the wait-free path
+  */
+ int mAddTail(MpscList *pList, Student student);
+ 
+ /**
+  * @brief Remove the student at the head of the log; consumer thread only
+  * @param pList Pointer to the log
+  * @param pOut Receives the student, may be NULL
+  * @return 1 if a student was removed, 0 if the log is empty
+  * @note  Also returns 0 while the only queued producer is between its
+  *        exchange and its link; the student shows up on a later call
+  */
+ int mDeleteHead(MpscList *pList, Student *pOut);
+ 
+ /**
+  * @brief Move every student currently in the log to the tail of a linked list
+  * @param pList Pointer to the log; consumer thread only
+  * @param pTarget Linked list to append to
+  * @return Number of students moved
+  * @note  pTarget and the default node pool must be used by this thread only
+  */
+ int mDrainToList(MpscList *pList, LinkedList *pTarget);
+ 
+ #endif /* MPSCLIST_H */
@@ -0,0 +1,250 @@
+/**
+ ******************************************************************************
+ * @file    nameindex.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of the open-addressing name index
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include "NameIndex.h"
+
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ /** @defgroup Table sizing
+  * @{
+  */
+ #define NAME_INDEX_MIN_CAPACITY             (64U)
+ #define NAME_INDEX_LOAD_NUM                 (7U)  /* Grow above 7/10 occupancy */
+ #define NAME_INDEX_LOAD_DEN                 (10U)
+ /**
+  * @}
+  */
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief FNV-1a hash of a name
+  * @param name Null-terminated name
+  * @return 32-bit hash
+  */
+ static uint32_t hashName(const char *name) {
+     uint32_t hash = 2166136261U;
+     while (*name != '\0') {
+         hash ^= (unsigned char)*name++;
+         hash *= 16777619U;
+     }
+     return hash;
+ }
+ 
+ /**
+  * @brief Find the slot of a name or the empty slot where it would go
+  * @param pIndex Pointer to the index
+  * @param name Name to look up
+  * @param hash Hash of the name
+  * @return Slot index
+  */
+ static size_t probe(const NameIndex *pIndex, const char *name, uint32_t hash) {
+     size_t mask = pIndex->capacity - 1;
+     size_t slot = hash & mask;
+     while (pIndex->pEntries[slot].count != 0) {
+         const NameIndexEntry *pEntry = &pIndex->pEntries[slot];
+         if (pEntry->hash == hash && strcmp(pEntry->pKey, name) == 0) {
+             return slot;
+         }
+         slot = (slot + 1) & mask;
+     }
+     return slot;
+ }
+ 
+ /**
+  * @brief Move every entry into a slot array of a new capacity
+  * @param pIndex Pointer to the index
+  * @param capacity New capacity (power of two)
+  * @return 1 on success, 0 if out of memory
+  */
+ static int resize(NameIndex *pIndex, size_t capacity) {
+     NameIndexEntry *pOld = pIndex->pEntries;
+     size_t oldCapacity = pIndex->capacity;
+     NameIndexEntry *pNew = (NameIndexEntry*)calloc(capacity, sizeof(NameIndexEntry));
+     if (pNew == NULL) return 0;
+     pIndex->pEntries = pNew;
+     pIndex->capacity = capacity;
+     for (size_t i = 0; i < oldCapacity; i++) {
+         if (pOld[i].count != 0) {
+             size_t slot = pOld[i].hash & (capacity - 1);
+             while (pNew[slot].count != 0) slot = (slot + 1) & (capacity - 1);
+             pNew[slot] = pOld[i];
+         }
+     }
+     free(pOld);
+     return 1;
+ }
+ 
+ /**
+  * @brief Create an empty name index
+  * @param expectedCount Number of names the index should hold without growing
+  * @return Pointer to the index, or NULL if out of memory
+  */
+ NameIndex* createNameIndex(size_t expectedCount) {
+     NameIndex *pIndex = (NameIndex*)malloc(sizeof(NameIndex));
+     size_t capacity = NAME_INDEX_MIN_CAPACITY;
+     if (pIndex == NULL) return NULL;
+     while (capacity * NAME_INDEX_LOAD_NUM <= expectedCount * NAME_INDEX_LOAD_DEN) {
+         capacity *= 2;
+     }
+     pIndex->pEntries = (NameIndexEntry*)calloc(capacity, sizeof(NameIndexEntry));
+     if (pIndex->pEntries == NULL) {
+         free(pIndex);
+         return NULL;
+     }
+     pIndex->capacity = capacity;
+     pIndex->used = 0;
+     return pIndex;
+ }
+ 
+ /**
+  * @brief Free the name index
+  * @param pIndex Pointer to the index (may be NULL)
+  */
+ void destroyNameIndex(NameIndex *pIndex) {
+     if (pIndex == NULL) return;
+     nameIndexClear(pIndex); /* Release owned copies of duplicate names */
+     free(pIndex->pEntries);
+     free(pIndex);
+ }
+ 
+ /**
+  * @brief Look up a name
+  * @param pIndex Pointer to the index
+  * @param name Name to look up
+  * @return Entry of the name, or NULL if no node has this name
+  */
+ NameIndexEntry* nameIndexFind(NameIndex *pIndex, const char *name) {
+     size_t slot = probe(pIndex, name, hashName(name));
+     return (pIndex->pEntries[slot].count != 0) ? &pIndex->pEntries[slot] : NULL;
+ }
+ 
+ /**
+  * @brief Record a node that was just linked into the list
+  * @param pIndex Pointer to the index
+  * @param pNode Node that was linked
+  * @param pPrev Node before it, NULL if it is the head
+  * @return 1 on success, 0 if the index could not grow
+  */
+ int nameIndexAdd(NameIndex *pIndex, Node *pNode, Node *pPrev) {
+     uint32_t hash = hashName(pNode->dataStudent.nameStudent);
+     size_t slot = probe(pIndex, pNode->dataStudent.nameStudent, hash);
+     NameIndexEntry *pEntry = &pIndex->pEntries[slot];
+ 
+     if (pEntry->count != 0) {
+         if (pEntry->pNode != NULL) {
+             /* Name is no longer unique: keep a private copy as the key */
+             size_t length = strlen(pEntry->pKey) + 1;
+             char *pCopy = (char*)malloc(length);
+             if (pCopy == NULL) return 0;
+             memcpy(pCopy, pEntry->pKey, length);
+             pEntry->pKey = pCopy;
+             pEntry->pNode = NULL;
+             pEntry->pPrev = NULL;
+         }
+         pEntry->count++;
+         return 1;
+     }
+     if ((pIndex->used + 1) * NAME_INDEX_LOAD_DEN > pIndex->capacity * NAME_INDEX_LOAD_NUM) {
+         if (!resize(pIndex, pIndex->capacity * 2)) return 0;
+         slot = probe(pIndex, pNode->dataStudent.nameStudent, hash);
+         pEntry = &pIndex->pEntries[slot];
+     }
+     pEntry->pKey = pNode->dataStudent.nameStudent;
+     pEntry->pNode = pNode;
+     pEntry->pPrev = pPrev;
+     pEntry->hash = hash;
+     pEntry->count = 1;
+     pIndex->used++;
+     return 1;
+ }
+ 
+ /**
+  * @brief Forget a node that is being unlinked from the list
+  * @param pIndex Pointer to the index
+  * @param pNode Node being unlinked (its name is still intact)
+  */
+ void nameIndexRemove(NameIndex *pIndex, const Node *pNode) {
+     size_t mask = pIndex->capacity - 1;
+     size_t hole = probe(pIndex, pNode->dataStudent.nameStudent, hashName(pNode->dataStudent.nameStudent));
+     NameIndexEntry *pEntry = &pIndex->pEntries[hole];
+ 
+     if (pEntry->count == 0) return;
+     if (--pEntry->count != 0) return; /* Other nodes still carry the name */
+     if (pEntry->pNode == NULL) {
+         free((char*)pEntry->pKey);
+     }
+     /* Backward-shift deletion keeps probe chains intact without tombstones */
+     for (size_t next = (hole + 1) & mask; pIndex->pEntries[next].count != 0; next = (next + 1) & mask) {
+         size_t home = pIndex->pEntries[next].hash & mask;
+         int stays = (hole <= next) ? (hole < home && home <= next) : (hole < home || home <= next);
+         if (!stays) {
+             pIndex->pEntries[hole] = pIndex->pEntries[next];
+             hole = next;
+         }
+     }
+     memset(&pIndex->pEntries[hole], 0, sizeof(NameIndexEntry));
+     pIndex->used--;
+ }
+ 
+ /**
+  * @brief Update the recorded predecessor of a node
+  * @param pIndex Pointer to the index
+  * @param pNode Node whose predecessor changed
+  * @param pPrev New predecessor, NULL if pNode became the head
+  */
+ void nameIndexSetPrev(NameIndex *pIndex, const Node *pNode, Node *pPrev) {
+     NameIndexEntry *pEntry = nameIndexFind(pIndex, pNode->dataStudent.nameStudent);
+     if (pEntry != NULL && pEntry->pNode == pNode) {
+         pEntry->pPrev = pPrev;
+     }
+ }
+ 
+ /**
+  * @brief Attach the only node with a name to its unresolved entry
+  * @param pEntry Entry returned by nameIndexFind with count 1
+  * @param pNode Node holding the name
+  * @param pPrev Node before it, NULL if it is the head
+  */
+ void nameIndexResolve(NameIndexEntry *pEntry, Node *pNode, Node *pPrev) {
+     if (pEntry->count != 1 || pEntry->pNode != NULL) return;
+     free((char*)pEntry->pKey);
+     pEntry->pKey = pNode->dataStudent.nameStudent;
+     pEntry->pNode = pNode;
+     pEntry->pPrev = pPrev;
+ }
+ 
+ /**
+  * @brief Remove every entry while keeping the slot array
+  * @param pIndex Pointer to the index
+  */
+ void nameIndexClear(NameIndex *pIndex) {
+     for (size_t i = 0; i < pIndex->capacity; i++) {
+         if (pIndex->pEntries[i].count != 0 && pIndex->pEntries[i].pNode == NULL) {
+             free((char*)pIndex->pEntries[i].pKey);
+         }
+     }
+     memset(pIndex->pEntries, 0, pIndex->capacity * sizeof(NameIndexEntry));
+     pIndex->used = 0;
+ }
@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file    nameindex.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for the open-addressing name index of a linked list
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef NAMEINDEX_H
+ #define NAMEINDEX_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include <stdint.h>
+ #include "linkedlist.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief One slot of the name index
+  * @note  A resolved entry (pNode set) is the only node with its name and
+  *        pKey points into that node. An unresolved entry owns a copy of the
+  *        name; the caller finds the node by scanning the list and, once the
+  *        name is unique again, resolves the entry.
+  */
+ typedef struct NameIndexEntry {
+     const char *pKey;      /* Name the entry is keyed on */
+     Node *pNode;           /* Node holding the name, NULL if unresolved */
+     Node *pPrev;           /* Node before pNode, NULL if pNode is the head */
+     uint32_t hash;         /* Full hash of the name */
+     uint32_t count;        /* Number of nodes with this name, 0 for an empty slot */
+ } NameIndexEntry;
+ 
+ /**
+  * @brief Linear-probing hash table keyed on nameStudent
+  */
+ typedef struct NameIndex {
+     NameIndexEntry *pEntries; /* Slot array, capacity is a power of two */
+     size_t capacity;          /* Number of slots */
+     size_t used;              /* Number of occupied slots */
+ } NameIndex;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Create an empty name index
+  * @param expectedCount Number of names the index should hold without growing
+  * @return Pointer to the index, or NULL if out of memory
+  */
+ NameIndex* createNameIndex(size_t expectedCount);
+ 
+ /**
+  * @brief Free the name index
+  * @param pIndex Pointer to the index (may be NULL)
+  */
+ void destroyNameIndex(NameIndex *pIndex);
+ 
+ /**
+  * @brief Look up a name
+  * @param pIndex Pointer to the index
+  * @param name Name to look up
+  * @return Entry of the name, or NULL if no node has this name
+  */
+ NameIndexEntry* nameIndexFind(NameIndex *pIndex, const char *name);
+ 
+ /**
+  * @brief Record a node that was just linked into the list
+  * @param pIndex Pointer to the index
+  * @param pNode Node that was linked
+  * @param pPrev Node before it, NULL if it is the head
+  * @return 1 on success, 0 if the index could not grow
+  */
+ int nameIndexAdd(NameIndex *pIndex, Node *pNode, Node *pPrev);
+ 
+ /**
+  * @brief Forget a node that is being unlinked from the list
+  * @param pIndex Pointer to the index
+  * @param pNode Node being unlinked (its name is still intact)
+  */
+ void nameIndexRemove(NameIndex *pIndex, const Node *pNode);
+ 
+ /**
+  * @brief Update the recorded predecessor of a node
+  * @param pIndex Pointer to the index
+  * @param pNode Node whose predecessor changed
+  * @param pPrev New predecessor, NULL if pNode became the head
+  */
+ void nameIndexSetPrev(NameIndex *pIndex, const Node *pNode, Node *pPrev);
+ 
+ /**
+  * @brief Attach the only node with a name to its unresolved entry
+  * @param pEntry Entry returned by nameIndexFind with count 1
+  * @param pNode Node holding the name
+  * @param pPrev Node before it, NULL if it is the head
+  */
+ void nameIndexResolve(NameIndexEntry *pEntry, Node *pNode, Node *pPrev);
+ 
+ /**
+  * @brief Remove every entry while keeping the slot array
+  * @param pIndex Pointer to the index
+  */
+ void nameIndexClear(NameIndex *pIndex);
+ 
+ #endif /* NAMEINDEX_H */
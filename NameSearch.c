@@ -0,0 +1,256 @@
+/**
+ ******************************************************************************
+ * @file    namesearch.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of prefix and case-insensitive name search
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+ 
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include "NameSearch.h"
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Lower-case an ASCII letter, leave other bytes alone
+  * @param c Character
+  * @return Folded character
+  */
+ static int foldChar(char c) {
+     unsigned char u = (unsigned char)c;
+     return (u >= 'A' && u <= 'Z') ? u + ('a' - 'A') : u;
+ }
+ 
+ /**
+  * @brief Compare two names ignoring the case of ASCII letters
+  * @param a First name
+  * @param b Second name
+  * @return Negative, zero or positive as for strcmp
+  */
+ static int compareFolded(const char *a, const char *b) {
+     for (;; a++, b++) {
+         int ca = foldChar(*a);
+         int cb = foldChar(*b);
+         if (ca != cb || ca == '\0') return ca - cb;
+     }
+ }
+ 
+ /**
+  * @brief Compare two names ignoring case first, then exactly
+  * @param a First name
+  * @param b Second name
+  * @return Negative, zero or positive as for strcmp, zero only for the same name
+  */
+ static int compareNames(const char *a, const char *b) {
+     int cmp = compareFolded(a, b);
+     return (cmp != 0) ? cmp : strcmp(a, b);
+ }
+ 
+ /**
+  * @brief Compare the start of a name with a prefix, ignoring the case of ASCII letters
+  * @param name Name
+  * @param prefix Prefix
+  * @return 0 if the name starts with the prefix, otherwise the order of the name against it
+  */
+ static int comparePrefixFolded(const char *name, const char *prefix) {
+     for (;; name++, prefix++) {
+         int cp = foldChar(*prefix);
+         int cn = foldChar(*name);
+         if (cp == '\0') return 0;
+         if (cn != cp) return cn - cp;
+     }
+ }
+ 
+ /**
+  * @brief Check whether a name contains a text, ignoring the case of ASCII letters
+  * @param name Name
+  * @param text Text to look for
+  * @return 1 if found, 0 otherwise
+  */
+ static int containsFolded(const char *name, const char *text) {
+     do {
+         if (comparePrefixFolded(name, text) == 0) return 1;
+     } while (*name++ != '\0');
+     return 0;
+ }
+ 
+ /**
+  * @brief Order two nodes by name ignoring case, then exactly, then list position
+  * @param pA First node
+  * @param pB Second node
+  * @return Negative, zero or positive as for strcmp, zero only for the same node
+  */
+ static int compareNodeNames(const Node *pA, const Node *pB) {
+     int cmp = compareNames(pA->dataStudent.nameStudent, pB->dataStudent.nameStudent);
+     if (cmp != 0) return cmp;
+     return (pA->orderLabel > pB->orderLabel) - (pA->orderLabel < pB->orderLabel);
+ }
+ 
+ /**
+  * @brief Check whether a node's name sorts before a text, ignoring case
+  * @param pNode Node
+  * @param pKey Text
+  * @return Non-zero if the folded name sorts before the folded text
+  */
+ static int nameBelow(const Node *pNode, const void *pKey) {
+     return compareFolded(pNode->dataStudent.nameStudent, (const char*)pKey) < 0;
+ }
+ 
+ /**
+  * @brief Create an empty prefix index, marked dirty until built
+  * @return Pointer to the index, or NULL if out of memory
+  */
+ PrefixIndex* createPrefixIndex(void) {
+     PrefixIndex *pIndex = (PrefixIndex*)malloc(sizeof(PrefixIndex));
+     if (pIndex == NULL) return NULL;
+     initSortedNodes(&pIndex->nodes, compareNodeNames, NULL); /* Names do not fit in an integer */
+     return pIndex;
+ }
+ 
+ /**
+  * @brief Free the prefix index
+  * @param pIndex Pointer to the index (may be NULL)
+  */
+ void destroyPrefixIndex(PrefixIndex *pIndex) {
+     if (pIndex == NULL) return;
+     freeSortedNodes(&pIndex->nodes);
+     free(pIndex);
+ }
+ 
+ /**
+  * @brief Rebuild the index from the nodes of a chain
+  * @param pIndex Pointer to the index
+  * @param pHead Head of the chain, labelled in increasing order
+  * @param count Number of nodes in the chain
+  * @return 1 on success, 0 if out of memory (the index stays dirty)
+  */
+ int prefixIndexRebuild(PrefixIndex *pIndex, Node *pHead, size_t count) {
+     Node **ppNodes = NULL;
+     size_t i = 0;
+     int built;
+     if (count != 0) {
+         ppNodes = (Node**)malloc(count * sizeof(Node*));
+         if (ppNodes == NULL) {
+             pIndex->nodes.dirty = 1;
+             return 0;
+         }
+     }
+     for (Node *current = pHead; current != NULL && i < count; current = current->pNextNode) ppNodes[i++] = current;
+     built = sortedNodesRebuild(&pIndex->nodes, ppNodes, count);
+     free(ppNodes);
+     return built;
+ }
+ 
+ /**
+  * @brief Add a node that was just linked
+  * @param pIndex Pointer to the index
+  * @param pNode Node, with its final name and label
+  * @return 1 on success, 0 if out of memory (the index is marked dirty)
+  */
+ int prefixIndexAdd(PrefixIndex *pIndex, Node *pNode) {
+     return sortedNodesAdd(&pIndex->nodes, pNode);
+ }
+ 
+ /**
+  * @brief Remove a node that is being unlinked or renamed
+  * @param pIndex Pointer to the index
+  * @param pNode Node, still holding the name and label it was added with
+  */
+ void prefixIndexRemove(PrefixIndex *pIndex, const Node *pNode) {
+     sortedNodesRemove(&pIndex->nodes, pNode);
+ }
+ 
+ /**
+  * @brief Check a name against the search text and flags
+  * @param name Name of a student
+  * @param text Search text
+  * @param length Length of the text
+  * @param flags NameSearch_TypeDef flags
+  * @return 1 if it matches, 0 otherwise
+  */
+ static int nameMatches(const char *name, const char *text, size_t length, int flags) {
+     int ignoreCase = (flags & NAME_SEARCH_IGNORE_CASE) != 0;
+     if (flags & NAME_SEARCH_SUBSTRING) {
+         return ignoreCase ? containsFolded(name, text) : (strstr(name, text) != NULL);
+     }
+     if (flags & NAME_SEARCH_PREFIX) {
+         return ignoreCase ? (comparePrefixFolded(name, text) == 0) : (strncmp(name, text, length) == 0);
+     }
+     return ignoreCase ? (compareFolded(name, text) == 0) : (strcmp(name, text) == 0);
+ }
+ 
+ /**
+  * @brief Keep a scan match if it is among the first maxOut in result order
+  * @param ppOut Matches so far, in result order
+  * @param found Nodes in ppOut
+  * @param maxOut Size of ppOut
+  * @param pNode Match, later in the list than every node in ppOut
+  * @return Nodes in ppOut afterwards
+  */
+ static int keepMatch(Node **ppOut, int found, int maxOut, Node *pNode) {
+     const char *name = pNode->dataStudent.nameStudent;
+     int lo = 0;
+     int hi = found;
+     if (found == maxOut && compareNames(ppOut[found - 1]->dataStudent.nameStudent, name) <= 0) return found;
+     while (lo < hi) { /* After equal names, so those stay in list order */
+         int mid = lo + (hi - lo) / 2;
+         if (compareNames(ppOut[mid]->dataStudent.nameStudent, name) <= 0) {
+             lo = mid + 1;
+         } else {
+             hi = mid;
+         }
+     }
+     if (found == maxOut) found--; /* The last one drops out */
+     memmove(&ppOut[lo + 1], &ppOut[lo], (size_t)(found - lo) * sizeof(Node*));
+     ppOut[lo] = pNode;
+     return found + 1;
+ }
+ 
+ /**
+  * @brief Find students by whole name, prefix or substring
+  * @param pList Pointer to the linked list
+  * @param text Name, prefix or substring to look for
+  * @param flags NAME_SEARCH_EXACT, NAME_SEARCH_PREFIX or NAME_SEARCH_SUBSTRING,
+  *        optionally with NAME_SEARCH_IGNORE_CASE
+  * @param ppOut Receives up to maxOut nodes
+  * @param maxOut Size of ppOut
+  * @return Number of nodes written
+  */
+ int searchStudentsByName(LinkedList *pList, const char *text, int flags, Node **ppOut, int maxOut) {
+     PrefixIndex *pIndex = pList->pPrefixIndex;
+     size_t length = strlen(text);
+     int found = 0;
+     if (maxOut <= 0) return 0;
+     if (pIndex != NULL && !(flags & NAME_SEARCH_SUBSTRING)
+         && (!pIndex->nodes.dirty || prefixIndexRebuild(pIndex, pList->pHead, (size_t)pList->nodeCount))) {
+         /* Every folded match is in one run starting at the first name >= text, already in result order */
+         SortedCursor cursor = sortedNodesSeek(&pIndex->nodes, nameBelow, text);
+         for (Node *pNode = sortedNodesAt(&pIndex->nodes, &cursor); pNode != NULL && found < maxOut;
+              pNode = sortedNodesAt(&pIndex->nodes, &cursor)) {
+             const char *name = pNode->dataStudent.nameStudent;
+             if (comparePrefixFolded(name, text) != 0) break; /* Past the run */
+             if (!(flags & NAME_SEARCH_PREFIX) && name[length] != '\0') break; /* Exact names come first */
+             if (nameMatches(name, text, length, flags)) ppOut[found++] = pNode; /* Else differs in case only */
+             cursor.slot++;
+         }
+         return found;
+     }
+     for (Node *current = pList->pHead; current != NULL; current = current->pNextNode) {
+         if (nameMatches(current->dataStudent.nameStudent, text, length, flags)) found = keepMatch(ppOut, found, maxOut, current);
+     }
+     return found;
+ }
@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * @file    namesearch.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for prefix and case-insensitive name search
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef NAMESEARCH_H
+ #define NAMESEARCH_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include "linkedlist.h"
+ #include "SortedNodes.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief How searchStudentsByName matches, flags combined with |
+  */
+ typedef enum {
+     NAME_SEARCH_EXACT = 0x0,       /* Whole name */
+     NAME_SEARCH_PREFIX = 0x1,      /* Name starts with the text */
+     NAME_SEARCH_SUBSTRING = 0x2,   /* Name contains the text; always a scan of the list */
+     NAME_SEARCH_IGNORE_CASE = 0x4  /* ASCII letters match in either case */
+ } NameSearch_TypeDef;
+ 
+ /**
+  * @brief Node pointers sorted by name ignoring case, then exactly, then list order
+  * @note  Kept in step by every insert, delete, rename and bulk change of
+  *        the list; students with the same name sit in list order through
+  *        the nodes' order labels. Only a failed allocation leaves it
+  *        dirty, and the next search then rebuilds it.
+  */
+ typedef struct PrefixIndex {
+     SortedNodes nodes;                      /* Every student, in index order */
+ } PrefixIndex;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Create an empty prefix index, marked dirty until built
+  * @return Pointer to the index, or NULL if out of memory
+  */
+ PrefixIndex* createPrefixIndex(void);
+ 
+ /**
+  * @brief Free the prefix index
+  * @param pIndex Pointer to the index (may be NULL)
+  */
+ void destroyPrefixIndex(PrefixIndex *pIndex);
+ 
+ /**
+  * @brief Rebuild the index from the nodes of a chain
+  * @param pIndex Pointer to the index
+  * @param pHead Head of the chain, labelled in increasing order
+  * @param count Number of nodes in the chain
+  * @return 1 on success, 0 if out of memory (the index stays dirty)
+  */
+ int prefixIndexRebuild(PrefixIndex *pIndex, Node *pHead, size_t count);
+ 
+ /**
+  * @brief Add a node that was just linked
+  * @param pIndex Pointer to the index
+  * @param pNode Node, with its final name and label
+  * @return 1 on success, 0 if out of memory (the index is marked dirty)
+  */
+ int prefixIndexAdd(PrefixIndex *pIndex, Node *pNode);
+ 
+ /**
+  * @brief Remove a node that is being unlinked or renamed
+  * @param pIndex Pointer to the index
+  * @param pNode Node, still holding the name and label it was added with
+  */
+ void prefixIndexRemove(PrefixIndex *pIndex, const Node *pNode);
+ 
+ /**
+  * @brief Find students by whole name, prefix or substring
+  * @param pList Pointer to the linked list
+  * @param text Name, prefix or substring to look for
+  * @param flags NAME_SEARCH_EXACT, NAME_SEARCH_PREFIX or NAME_SEARCH_SUBSTRING,
+  *        optionally with NAME_SEARCH_IGNORE_CASE
+  * @param ppOut Receives up to maxOut nodes
+  * @param maxOut Size of ppOut
+  * @return Number of nodes written
+  * @note  Nodes always come by name ignoring case, then by exact name,
+  *        and students with the same name in list order, so a search
+  *        truncated at maxOut returns the same nodes whichever way it runs.
+  *        With the prefix index enabled, exact and prefix searches cost
+  *        O(log n + results), the index holding them in that order already.
+  *        Otherwise, for substrings, or if the index cannot be rebuilt, the
+  *        whole list is scanned and the first maxOut matches kept in order
+  *        as they come. Handles are valid until the list next
+  *        changes.
+  */
+ int searchStudentsByName(LinkedList *pList, const char *text, int flags, Node **ppOut, int maxOut);
+ 
+ #endif /* NAMESEARCH_H */
@@ -0,0 +1,300 @@
+/**
+ ******************************************************************************
+ * @file    positionindex.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of the skip-list positional index
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include "PositionIndex.h"
+
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Draw a tower height: 0 (no tower) with probability 3/4, then geometric
+  * @param pIndex Pointer to the index
+  * @return Number of levels of the new tower
+  */
+ static int randomLevel(PositionIndex *pIndex) {
+     uint32_t x = pIndex->seed;
+     int level = 0;
+     x ^= x << 13; /* xorshift32 */
+     x ^= x >> 17;
+     x ^= x << 5;
+     pIndex->seed = x;
+     while ((x & 3U) == 0 && level < (int)POS_INDEX_MAX_LEVEL) {
+         level++;
+         x >>= 2;
+     }
+     return level;
+ }
+ 
+ /**
+  * @brief Allocate a tower
+  * @param pNode Node the tower stands on
+  * @param level Number of links
+  * @return Pointer to the tower, or NULL if out of memory
+  */
+ static PosTower* createTower(Node *pNode, int level) {
+     PosTower *pTower = (PosTower*)malloc(sizeof(PosTower) + (size_t)level * sizeof(PosLink));
+     if (pTower == NULL) return NULL;
+     pTower->pNode = pNode;
+     pTower->level = level;
+     return pTower;
+ }
+ 
+ /**
+  * @brief Free every tower except the header
+  * @param pIndex Pointer to the index
+  */
+ static void freeTowers(PositionIndex *pIndex) {
+     PosTower *pTower = (pIndex->level > 0) ? pIndex->pHeader->links[0].pNext : NULL;
+     while (pTower != NULL) {
+         PosTower *pNext = pTower->links[0].pNext;
+         free(pTower);
+         pTower = pNext;
+     }
+     pIndex->level = 0;
+ }
+ 
+ /**
+  * @brief Find, on every level, the last tower standing before a position
+  * @param pIndex Pointer to the index
+  * @param position Position (1-based)
+  * @param update Receives the towers
+  * @param rank Receives their positions
+  */
+ static void findUpdate(PositionIndex *pIndex, int position, PosTower **update, int *rank) {
+     PosTower *x = pIndex->pHeader;
+     int r = 0;
+     for (int i = pIndex->level - 1; i >= 0; i--) {
+         while (x->links[i].pNext != NULL && r + x->links[i].span < position) {
+             r += x->links[i].span;
+             x = x->links[i].pNext;
+         }
+         update[i] = x;
+         rank[i] = r;
+     }
+ }
+ 
+ /**
+  * @brief Create an empty positional index
+  * @return Pointer to the index, or NULL if out of memory
+  */
+ PositionIndex* createPositionIndex(void) {
+     PositionIndex *pIndex = (PositionIndex*)malloc(sizeof(PositionIndex));
+     if (pIndex == NULL) return NULL;
+     pIndex->pHeader = createTower(NULL, POS_INDEX_MAX_LEVEL);
+     if (pIndex->pHeader == NULL) {
+         free(pIndex);
+         return NULL;
+     }
+     pIndex->level = 0;
+     pIndex->dirty = 1; /* Nothing indexed yet */
+     pIndex->seed = 2463534242U;
+     return pIndex;
+ }
+ 
+ /**
+  * @brief Free the positional index
+  * @param pIndex Pointer to the index (may be NULL)
+  */
+ void destroyPositionIndex(PositionIndex *pIndex) {
+     if (pIndex == NULL) return;
+     freeTowers(pIndex);
+     free(pIndex->pHeader);
+     free(pIndex);
+ }
+ 
+ /**
+  * @brief Rebuild the towers from scratch for the current chain
+  * @param pIndex Pointer to the index
+  * @param pHead Head of the chain
+  * @return 1 on success, 0 if out of memory
+  */
+ int positionIndexRebuild(PositionIndex *pIndex, Node *pHead) {
+     int lastPos[POS_INDEX_MAX_LEVEL];
+     int position = 0;
+ 
+     freeTowers(pIndex);
+     pIndex->level = 1;
+     pIndex->pLast[0] = pIndex->pHeader;
+     lastPos[0] = 0;
+     for (Node *current = pHead; current != NULL; current = current->pNextNode) {
+         int level = randomLevel(pIndex);
+         position++;
+         if (level == 0) continue;
+         PosTower *pTower = createTower(current, level);
+         if (pTower == NULL) {
+             pIndex->dirty = 1;
+             for (int i = 0; i < pIndex->level; i++) pIndex->pLast[i]->links[i].pNext = NULL;
+             freeTowers(pIndex);
+             return 0;
+         }
+         for (int i = pIndex->level; i < level; i++) {
+             pIndex->pLast[i] = pIndex->pHeader; /* Open a new level */
+             lastPos[i] = 0;
+         }
+         if (level > pIndex->level) pIndex->level = level;
+         for (int i = 0; i < level; i++) {
+             pIndex->pLast[i]->links[i].pNext = pTower;
+             pIndex->pLast[i]->links[i].span = position - lastPos[i];
+             pIndex->pLast[i] = pTower;
+             lastPos[i] = position;
+         }
+     }
+     for (int i = 0; i < pIndex->level; i++) {
+         pIndex->pLast[i]->links[i].pNext = NULL;
+         pIndex->pLast[i]->links[i].span = position - lastPos[i]; /* Distance to the last node */
+     }
+     pIndex->dirty = 0;
+     return 1;
+ }
+ 
+ /**
+  * @brief Find the node just before a position
+  * @param pIndex Pointer to the index
+  * @param pHead Head of the chain
+  * @param position Position (1-based), at most count + 1
+  * @return Node at position - 1, or NULL when position is 1
+  */
+ Node* positionIndexNodeBefore(PositionIndex *pIndex, Node *pHead, int position) {
+     PosTower *x = pIndex->pHeader;
+     int r = 0;
+     for (int i = pIndex->level - 1; i >= 0; i--) {
+         while (x->links[i].pNext != NULL && r + x->links[i].span <= position - 1) {
+             r += x->links[i].span;
+             x = x->links[i].pNext;
+         }
+     }
+     Node *current = x->pNode; /* NULL for the header at position 0 */
+     for (; r < position - 1; r++) {
+         current = (current == NULL) ? pHead : current->pNextNode; /* Short walk on the chain */
+     }
+     return current;
+ }
+ 
+ /**
+  * @brief Find the last node that sorts at or before a student, in a chain sorted by keys
+  * @param pIndex Pointer to the index
+  * @param pHead Head of the chain
+  * @param pStudent Student to place
+  * @param keys Sort keys the chain is ordered by
+  * @param nkeys Number of keys
+  * @param pPosition Receives the position of that node, 0 if there is none
+  * @return That node, or NULL if the student sorts before the head
+  */
+ Node* positionIndexUpperBound(PositionIndex *pIndex, Node *pHead, const Student *pStudent,
+                               const SortKey *keys, int nkeys, int *pPosition) {
+     PosTower *x = pIndex->pHeader;
+     int r = 0;
+     for (int i = pIndex->level - 1; i >= 0; i--) {
+         while (x->links[i].pNext != NULL
+                && compareStudentsByKeys(&x->links[i].pNext->pNode->dataStudent, pStudent, keys, nkeys) <= 0) {
+             r += x->links[i].span;
+             x = x->links[i].pNext;
+         }
+     }
+     Node *current = x->pNode; /* NULL for the header at position 0 */
+     Node *next = (current == NULL) ? pHead : current->pNextNode;
+     while (next != NULL && compareStudentsByKeys(&next->dataStudent, pStudent, keys, nkeys) <= 0) {
+         current = next; /* Short walk on the chain */
+         next = next->pNextNode;
+         r++;
+     }
+     *pPosition = r;
+     return current;
+ }
+ 
+ /**
+  * @brief Account for a node that was just linked at a position
+  * @param pIndex Pointer to the index
+  * @param pNode Node that was linked
+  * @param position Its position (1-based)
+  * @param countBefore Node count before the insertion
+  * @return 1 on success, 0 if out of memory
+  */
+ int positionIndexInsert(PositionIndex *pIndex, Node *pNode, int position, int countBefore) {
+     PosTower *update[POS_INDEX_MAX_LEVEL];
+     int rank[POS_INDEX_MAX_LEVEL];
+     int level = randomLevel(pIndex);
+     int prevPos = position - 1;
+     PosTower *pTower = NULL;
+ 
+     if (position == countBefore + 1) {
+         for (int i = 0; i < pIndex->level; i++) { /* Append: O(levels) through the last towers */
+             update[i] = pIndex->pLast[i];
+             rank[i] = countBefore - pIndex->pLast[i]->links[i].span;
+         }
+     } else {
+         findUpdate(pIndex, position, update, rank);
+     }
+     if (level > 0) {
+         pTower = createTower(pNode, level);
+         if (pTower == NULL) return 0;
+         for (int i = pIndex->level; i < level; i++) {
+             pIndex->pHeader->links[i].pNext = NULL;
+             pIndex->pHeader->links[i].span = countBefore;
+             pIndex->pLast[i] = pIndex->pHeader;
+             update[i] = pIndex->pHeader;
+             rank[i] = 0;
+         }
+         if (level > pIndex->level) pIndex->level = level;
+     }
+     for (int i = 0; i < pIndex->level; i++) {
+         if (i < level) {
+             pTower->links[i].pNext = update[i]->links[i].pNext;
+             pTower->links[i].span = update[i]->links[i].span - (prevPos - rank[i]);
+             update[i]->links[i].pNext = pTower;
+             update[i]->links[i].span = prevPos - rank[i] + 1;
+             if (pTower->links[i].pNext == NULL) pIndex->pLast[i] = pTower;
+         } else {
+             update[i]->links[i].span++; /* Node lands inside this link */
+         }
+     }
+     return 1;
+ }
+ 
+ /**
+  * @brief Account for a node that is being unlinked from a position
+  * @param pIndex Pointer to the index
+  * @param pNode Node being unlinked
+  * @param position Its position (1-based)
+  */
+ void positionIndexRemove(PositionIndex *pIndex, const Node *pNode, int position) {
+     PosTower *update[POS_INDEX_MAX_LEVEL];
+     int rank[POS_INDEX_MAX_LEVEL];
+     PosTower *pTower;
+ 
+     findUpdate(pIndex, position, update, rank);
+     pTower = update[0]->links[0].pNext;
+     if (pTower != NULL && pTower->pNode != pNode) pTower = NULL; /* Node has no tower */
+     for (int i = 0; i < pIndex->level; i++) {
+         if (pTower != NULL && update[i]->links[i].pNext == pTower) {
+             update[i]->links[i].span += pTower->links[i].span - 1;
+             update[i]->links[i].pNext = pTower->links[i].pNext;
+             if (pIndex->pLast[i] == pTower) pIndex->pLast[i] = update[i];
+         } else {
+             update[i]->links[i].span--;
+         }
+     }
+     free(pTower);
+     while (pIndex->level > 1 && pIndex->pHeader->links[pIndex->level - 1].pNext == NULL) {
+         pIndex->level--; /* Drop empty top levels */
+     }
+ }
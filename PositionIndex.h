@@ -0,0 +1,132 @@
+/**
+ ******************************************************************************
+ * @file    positionindex.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for the skip-list positional index of a linked list
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef POSITIONINDEX_H
+ #define POSITIONINDEX_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include <stdint.h>
+ #include "linkedlist.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define POS_INDEX_MAX_LEVEL                 (24U) /* Enough for 4^24 nodes */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Forward link of a tower on one level
+  */
+ typedef struct PosLink {
+     struct PosTower *pNext; /* Next tower on this level, NULL at the end */
+     int span;               /* Positions from this tower to pNext (to the last node if NULL) */
+ } PosLink;
+ 
+ /**
+  * @brief Express-lane tower standing on one node of the chain
+  */
+ typedef struct PosTower {
+     Node *pNode;            /* Node the tower stands on, NULL for the header */
+     int level;              /* Number of links */
+     PosLink links[];        /* Links, level 0 first */
+ } PosTower;
+ 
+ /**
+  * @brief Indexable skip list layered over the pNextNode chain
+  * @note  Roughly one node in four carries a tower, so a lookup descends the
+  *        towers in O(log n) and then walks a few nodes of the chain
+  */
+ typedef struct PositionIndex {
+     PosTower *pHeader;                      /* Sentinel at position 0 */
+     PosTower *pLast[POS_INDEX_MAX_LEVEL];   /* Last tower on each level */
+     int level;                              /* Levels in use */
+     int dirty;                              /* Chain changed at unknown positions */
+     uint32_t seed;                          /* Level generator state */
+ } PositionIndex;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Create an empty positional index
+  * @return Pointer to the index, or NULL if out of memory
+  */
+ PositionIndex* createPositionIndex(void);
+ 
+ /**
+  * @brief Free the positional index
+  * @param pIndex Pointer to the index (may be NULL)
+  */
+ void destroyPositionIndex(PositionIndex *pIndex);
+ 
+ /**
+  * @brief Rebuild the towers from scratch for the current chain
+  * @param pIndex Pointer to the index
+  * @param pHead Head of the chain
+  * @return 1 on success, 0 if out of memory
+  */
+ int positionIndexRebuild(PositionIndex *pIndex, Node *pHead);
+ 
+ /**
+  * @brief Find the node just before a position
+  * @param pIndex Pointer to the index
+  * @param pHead Head of the chain
+  * @param position Position (1-based), at most count + 1
+  * @return Node at position - 1, or NULL when position is 1
+  */
+ Node* positionIndexNodeBefore(PositionIndex *pIndex, Node *pHead, int position);
+ 
+ /**
+  * @brief Find the last node that sorts at or before a student, in a chain sorted by keys
+  * @param pIndex Pointer to the index
+  * @param pHead Head of the chain
+  * @param pStudent Student to place
+  * @param keys Sort keys the chain is ordered by
+  * @param nkeys Number of keys
+  * @param pPosition Receives the position of that node, 0 if there is none
+  * @return That node, or NULL if the student sorts before the head
+  * @note  Descends the towers comparing keys instead of positions, so equal
+  *        students are passed over and a new one lands after them
+  */
+ Node* positionIndexUpperBound(PositionIndex *pIndex, Node *pHead, const Student *pStudent,
+                               const SortKey *keys, int nkeys, int *pPosition);
+ 
+ /**
+  * @brief Account for a node that was just linked at a position
+  * @param pIndex Pointer to the index
+  * @param pNode Node that was linked
+  * @param position Its position (1-based)
+  * @param countBefore Node count before the insertion
+  * @return 1 on success, 0 if out of memory
+  */
+ int positionIndexInsert(PositionIndex *pIndex, Node *pNode, int position, int countBefore);
+ 
+ /**
+  * @brief Account for a node that is being unlinked from a position
+  * @param pIndex Pointer to the index
+  * @param pNode Node being unlinked
+  * @param position Its position (1-based)
+  */
+ void positionIndexRemove(PositionIndex *pIndex, const Node *pNode, int position);
+ 
+ #endif /* POSITIONINDEX_H */
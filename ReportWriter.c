@@ -0,0 +1,528 @@
+/**
+ ******************************************************************************
+ * @file    reportwriter.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of the buffered student report writer
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include <math.h>
+ #include <stdint.h>
+ #include "ReportWriter.h"
+ #include "WorkerThreads.h"
+
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define REPORT_MAX_FIELD                    (64)     /* Largest number or padding step appended at once */
+ #define REPORT_FAST_LIMIT                   (1e13)   /* Keeps value * 100 below 2^53 */
+ #define REPORT_SEGMENT_ROWS                 (16384)  /* Rows one thread formats per round */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Contiguous run of students formatted by one thread
+  */
+ typedef struct ReportSegment {
+     const Node *pFirst;            /* First node of the run */
+     size_t rows;                   /* Number of nodes in the run */
+     int firstNumber;               /* Row number of pFirst */
+     ReportFormat_TypeDef format;   /* Report layout */
+     ReportWriter writer;           /* Growing buffer the run is formatted into */
+ } ReportSegment;
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Write the buffered bytes to the stream
+  * @param pWriter Pointer to the writer
+  */
+ static void flushReport(ReportWriter *pWriter) {
+     if (pWriter->used != 0 && !pWriter->failed
+         && fwrite(pWriter->pBuffer, 1, pWriter->used, pWriter->pFile) != pWriter->used) {
+         pWriter->failed = 1;
+     }
+     pWriter->used = 0;
+ }
+ 
+ /**
+  * @brief Double the buffer of a writer that has no stream
+  * @param pWriter Pointer to the writer
+  * @note  If that fails the writer is marked failed and its bytes are dropped,
+  *        so the buffer keeps room for at least REPORT_FALLBACK_SIZE more
+  */
+ static void growReport(ReportWriter *pWriter) {
+     size_t capacity = pWriter->capacity * 2;
+     char *pBigger = (pWriter->pBuffer == pWriter->fallback) ? (char*)malloc(capacity)
+                                                             : (char*)realloc(pWriter->pBuffer, capacity);
+     if (pBigger == NULL) {
+         pWriter->failed = 1;
+         pWriter->used = 0;
+         return;
+     }
+     if (pWriter->pBuffer == pWriter->fallback) memcpy(pBigger, pWriter->fallback, pWriter->used);
+     pWriter->pBuffer = pBigger;
+     pWriter->capacity = capacity;
+ }
+ 
+ /**
+  * @brief Make sure the buffer has room for some bytes
+  * @param pWriter Pointer to the writer
+  * @param size Bytes needed, at most REPORT_FALLBACK_SIZE
+  * @return Pointer to where the bytes go
+  */
+ static char* reserveReport(ReportWriter *pWriter, size_t size) {
+     if (pWriter->used + size > pWriter->capacity) {
+         if (pWriter->pFile == NULL) growReport(pWriter);
+         else flushReport(pWriter);
+     }
+     return pWriter->pBuffer + pWriter->used;
+ }
+ 
+ /**
+  * @brief Append spaces
+  * @param pWriter Pointer to the writer
+  * @param count Number of spaces
+  */
+ static void putSpaces(ReportWriter *pWriter, int count) {
+     while (count > 0) {
+         int step = (count < REPORT_MAX_FIELD) ? count : REPORT_MAX_FIELD;
+         memset(reserveReport(pWriter, (size_t)step), ' ', (size_t)step);
+         pWriter->used += (size_t)step;
+         count -= step;
+     }
+ }
+ 
+ /**
+  * @brief Append bytes
+  * @param pWriter Pointer to the writer
+  * @param pBytes Bytes to append
+  * @param length Number of bytes
+  */
+ static void putBytes(ReportWriter *pWriter, const char *pBytes, size_t length) {
+     while (length > 0) {
+         size_t step = (length < REPORT_FALLBACK_SIZE) ? length : REPORT_FALLBACK_SIZE;
+         memcpy(reserveReport(pWriter, step), pBytes, step);
+         pWriter->used += step;
+         pBytes += step;
+         length -= step;
+     }
+ }
+ 
+ /**
+  * @brief Start writing to a stream
+  * @param pWriter Pointer to the writer
+  * @param pFile Destination stream, e.g. stdout or a file opened for writing,
+  *              or NULL to keep everything in a growing buffer
+  */
+ void initReportWriter(ReportWriter *pWriter, FILE *pFile) {
+     pWriter->pFile = pFile;
+     pWriter->used = 0;
+     pWriter->failed = 0;
+     pWriter->pBuffer = (char*)malloc(REPORT_BUFFER_SIZE);
+     pWriter->capacity = REPORT_BUFFER_SIZE;
+     if (pWriter->pBuffer == NULL) {
+         pWriter->pBuffer = pWriter->fallback; /* Still correct, just more writes */
+         pWriter->capacity = REPORT_FALLBACK_SIZE;
+     }
+ }
+ 
+ /**
+  * @brief Flush what is left and release the buffer
+  * @param pWriter Pointer to the writer
+  * @return 1 if every write succeeded, 0 otherwise
+  */
+ int finishReportWriter(ReportWriter *pWriter) {
+     if (pWriter->pFile != NULL) {
+         flushReport(pWriter);
+         if (fflush(pWriter->pFile) != 0) pWriter->failed = 1;
+     }
+     if (pWriter->pBuffer != pWriter->fallback) free(pWriter->pBuffer);
+     pWriter->pBuffer = NULL;
+     pWriter->capacity = 0;
+     return !pWriter->failed;
+ }
+ 
+ /**
+  * @brief Append a string
+  * @param pWriter Pointer to the writer
+  * @param text Null-terminated text
+  */
+ void reportPutString(ReportWriter *pWriter, const char *text) {
+     putBytes(pWriter, text, strlen(text));
+ }
+ 
+ /**
+  * @brief Append a string left-justified in a field, like printf("%-*s")
+  * @param pWriter Pointer to the writer
+  * @param text Null-terminated text
+  * @param width Minimum field width
+  */
+ void reportPutPadded(ReportWriter *pWriter, const char *text, int width) {
+     size_t length = strlen(text);
+     putBytes(pWriter, text, length);
+     if ((size_t)width > length) putSpaces(pWriter, width - (int)length);
+ }
+ 
+ /**
+  * @brief Append an integer left-justified in a field, like printf("%-*d")
+  * @param pWriter Pointer to the writer
+  * @param value Value
+  * @param width Minimum field width, 0 for none
+  */
+ void reportPutInt(ReportWriter *pWriter, int value, int width) {
+     char digits[12];
+     int length = 0;
+     unsigned int magnitude = (value < 0) ? 0U - (unsigned int)value : (unsigned int)value;
+     char *pOut = reserveReport(pWriter, sizeof(digits));
+     do {
+         digits[length++] = (char)('0' + magnitude % 10U);
+         magnitude /= 10U;
+     } while (magnitude != 0);
+     if (value < 0) digits[length++] = '-';
+     for (int i = 0; i < length; i++) pOut[i] = digits[length - 1 - i];
+     pWriter->used += (size_t)length;
+     putSpaces(pWriter, width - length);
+ }
+ 
+ /**
+  * @brief Append a value with two decimals left-justified in a field, like printf("%-*.2f")
+  * @param pWriter Pointer to the writer
+  * @param value Value
+  * @param width Minimum field width, 0 for none
+  */
+ void reportPutFixed2(ReportWriter *pWriter, double value, int width) {
+     char text[REPORT_MAX_FIELD];
+     int length = 0;
+     if (!(fabs(value) < REPORT_FAST_LIMIT)) {
+         length = snprintf(text, sizeof(text), "%.2f", value); /* Huge, infinite or NaN */
+         if (length < 0 || length >= (int)sizeof(text)) {
+             char *pBig = (char*)malloc((size_t)((length > 0) ? length : 0) + 1);
+             if (pBig != NULL && length > 0) {
+                 snprintf(pBig, (size_t)length + 1, "%.2f", value);
+                 reportPutPadded(pWriter, pBig, width);
+             }
+             free(pBig);
+             return;
+         }
+     } else {
+         double hundredths = fabs(value) * 100.0;
+         double error = fma(fabs(value), 100.0, -hundredths); /* Exact rounding error, 0 for any float */
+         double whole = floor(hundredths);
+         double fraction = hundredths - whole;
+         unsigned long long scaled = (unsigned long long)whole;
+         char digits[24];
+         int count = 0;
+         if (fraction > 0.5 || (fraction == 0.5 && (error > 0 || (error == 0 && (scaled & 1ULL))))) {
+             scaled++; /* Nearest, ties to even; only an exact .5 can hide which side the product fell on */
+         }
+         if (signbit(value)) text[length++] = '-';
+         do {
+             digits[count++] = (char)('0' + scaled % 10ULL);
+             scaled /= 10ULL;
+         } while (scaled != 0 || count < 3); /* At least one integer digit */
+         for (int i = count - 1; i >= 2; i--) text[length++] = digits[i];
+         text[length++] = '.';
+         text[length++] = digits[1];
+         text[length++] = digits[0];
+     }
+     text[length] = '\0';
+     putBytes(pWriter, text, (size_t)length);
+     putSpaces(pWriter, width - length);
+ }
+ 
+ /**
+  * @brief Append a string with CSV quoting when needed
+  * @param pWriter Pointer to the writer
+  * @param text Null-terminated text
+  */
+ static void putCsvField(ReportWriter *pWriter, const char *text) {
+     if (strpbrk(text, ",\"\r\n") == NULL) {
+         reportPutString(pWriter, text);
+         return;
+     }
+     putBytes(pWriter, "\"", 1);
+     for (const char *p = text; *p != '\0'; p++) {
+         if (*p == '"') putBytes(pWriter, "\"", 1); /* Double embedded quotes */
+         putBytes(pWriter, p, 1);
+     }
+     putBytes(pWriter, "\"", 1);
+ }
+ 
+ /**
+  * @brief Append a JSON string literal
+  * @param pWriter Pointer to the writer
+  * @param text Null-terminated text
+  */
+ static void putJsonString(ReportWriter *pWriter, const char *text) {
+     static const char hexDigits[] = "0123456789abcdef";
+     putBytes(pWriter, "\"", 1);
+     for (const unsigned char *p = (const unsigned char*)text; *p != '\0'; p++) {
+         if (*p == '"' || *p == '\\') {
+             char escaped[2] = { '\\', (char)*p };
+             putBytes(pWriter, escaped, 2);
+         } else if (*p < 0x20) {
+             char escaped[6] = { '\\', 'u', '0', '0', hexDigits[*p >> 4], hexDigits[*p & 15] };
+             putBytes(pWriter, escaped, 6);
+         } else {
+             putBytes(pWriter, (const char*)p, 1);
+         }
+     }
+     putBytes(pWriter, "\"", 1);
+ }
+ 
+ /**
+  * @brief Write what comes before the first student
+  * @param pWriter Pointer to the writer
+  * @param format Report layout
+  */
+ static void putReportHeader(ReportWriter *pWriter, ReportFormat_TypeDef format) {
+     switch (format) {
+         case REPORT_FORMAT_CONSOLE:
+             reportPutString(pWriter, "\n======================List of students=======================\n"
+                                      "No.\t");
+             reportPutPadded(pWriter, "Name", 30);
+             reportPutString(pWriter, "\t");
+             reportPutPadded(pWriter, "Age", 10);
+             reportPutString(pWriter, "\t");
+             reportPutPadded(pWriter, "GPA", 10);
+             reportPutString(pWriter, "\n=============================================================\n");
+             break;
+         case REPORT_FORMAT_TABLE:
+             reportPutString(pWriter, "========================================================\n| ");
+             reportPutPadded(pWriter, "No.", 3);
+             reportPutString(pWriter, " | ");
+             reportPutPadded(pWriter, "Name", 50);
+             reportPutString(pWriter, " | ");
+             reportPutPadded(pWriter, "Age", 5);
+             reportPutString(pWriter, " | ");
+             reportPutPadded(pWriter, "GPA", 7);
+             reportPutString(pWriter, " |\n========================================================\n");
+             break;
+         case REPORT_FORMAT_CSV:
+             reportPutString(pWriter, "name,age,gpa\n");
+             break;
+         default:
+             break;
+     }
+ }
+ 
+ /**
+  * @brief Write one student in a report layout
+  * @param pWriter Pointer to the writer
+  * @param format Report layout
+  * @param number Row number shown in the numbered layouts
+  * @param name Name of the student
+  * @param age Age of the student
+  * @param gpa GPA of the student
+  */
+ static void putStudentRow(ReportWriter *pWriter, ReportFormat_TypeDef format, int number,
+                           const char *name, int age, float gpa) {
+     switch (format) {
+         case REPORT_FORMAT_CONSOLE:
+             reportPutInt(pWriter, number, 0);
+             putBytes(pWriter, "\t", 1);
+             reportPutPadded(pWriter, name, 30);
+             putBytes(pWriter, "\t", 1);
+             reportPutInt(pWriter, age, 10);
+             putBytes(pWriter, "\t", 1);
+             reportPutFixed2(pWriter, gpa, 10);
+             putBytes(pWriter, "\n", 1);
+             break;
+         case REPORT_FORMAT_TABLE:
+             putBytes(pWriter, "| ", 2);
+             reportPutInt(pWriter, number, 3);
+             putBytes(pWriter, " | ", 3);
+             reportPutPadded(pWriter, name, 50);
+             putBytes(pWriter, " | ", 3);
+             reportPutInt(pWriter, age, 5);
+             putBytes(pWriter, " | ", 3);
+             reportPutFixed2(pWriter, gpa, 7);
+             putBytes(pWriter, " |\n", 3);
+             break;
+         case REPORT_FORMAT_CSV:
+             putCsvField(pWriter, name);
+             putBytes(pWriter, ",", 1);
+             reportPutInt(pWriter, age, 0);
+             putBytes(pWriter, ",", 1);
+             reportPutFixed2(pWriter, gpa, 0);
+             putBytes(pWriter, "\n", 1);
+             break;
+         case REPORT_FORMAT_JSON_LINES:
+             reportPutString(pWriter, "{\"name\":");
+             putJsonString(pWriter, name);
+             reportPutString(pWriter, ",\"age\":");
+             reportPutInt(pWriter, age, 0);
+             reportPutString(pWriter, ",\"gpa\":");
+             reportPutFixed2(pWriter, gpa, 0);
+             putBytes(pWriter, "}\n", 2);
+             break;
+         default:
+             break;
+     }
+ }
+ 
+ /**
+  * @brief Write a run of consecutive students
+  * @param pWriter Pointer to the writer
+  * @param pFirst First node of the run
+  * @param rows Number of students to write, stops early at the end of the list
+  * @param firstNumber Row number shown for pFirst in the numbered layouts
+  * @param format Report layout
+  */
+ static void putStudentRows(ReportWriter *pWriter, const Node *pFirst, size_t rows, int firstNumber,
+                            ReportFormat_TypeDef format) {
+     int countStudent = firstNumber;
+     for (const Node *pTemp = pFirst; pTemp != NULL && rows > 0; pTemp = pTemp->pNextNode, rows--) {
+         putStudentRow(pWriter, format, countStudent++, pTemp->dataStudent.nameStudent,
+                       pTemp->dataStudent.ageStudent, pTemp->dataStudent.GPA);
+     }
+ }
+ 
+ /**
+  * @brief Write what comes after the last student
+  * @param pWriter Pointer to the writer
+  * @param format Report layout
+  * @param pDistribution GPA distribution appended to REPORT_FORMAT_TABLE, NULL to leave it out
+  */
+ static void putReportFooter(ReportWriter *pWriter, ReportFormat_TypeDef format,
+                             const GpaDistribution *pDistribution) {
+     if (format == REPORT_FORMAT_TABLE && pDistribution != NULL) {
+         const char *labels[4] = { "Excellent (3.5 - 4.0)", "Good (3.0 - 3.49)", "Average (2.0 - 2.99)", "Weak (< 2.0)" };
+         const int counts[4] = { pDistribution->excellent, pDistribution->good,
+                                 pDistribution->average, pDistribution->weak };
+         reportPutString(pWriter, "============================================\n\n"
+                                  "                   GPA DISTRIBUTION\n"
+                                  "========================================================\n");
+         for (int i = 0; i < 4; i++) {
+             putBytes(pWriter, "| ", 2);
+             reportPutPadded(pWriter, labels[i], 54);
+             putBytes(pWriter, " | ", 3);
+             reportPutInt(pWriter, counts[i], 5);
+             putBytes(pWriter, " |\n", 3);
+         }
+         reportPutString(pWriter, "========================================================\n");
+     }
+ }
+ 
+ /**
+  * @brief Format one segment of a parallel report into its own buffer
+  * @param pTask Pointer to a ReportSegment
+  */
+ static void formatReportSegment(void *pTask) {
+     ReportSegment *pSegment = (ReportSegment*)pTask;
+     pSegment->writer.used = 0;
+     putStudentRows(&pSegment->writer, pSegment->pFirst, pSegment->rows, pSegment->firstNumber, pSegment->format);
+ }
+ 
+ /**
+  * @brief Append a formatted segment, writing it straight to the stream
+  * @param pWriter Pointer to the writer
+  * @param pSegment Segment formatted by formatReportSegment
+  */
+ static void putReportSegment(ReportWriter *pWriter, const ReportSegment *pSegment) {
+     if (pSegment->writer.failed) {
+         /* Its buffer couldn't grow: format it again here, straight into the output */
+         putStudentRows(pWriter, pSegment->pFirst, pSegment->rows, pSegment->firstNumber, pSegment->format);
+         return;
+     }
+     if (pWriter->pFile == NULL) {
+         putBytes(pWriter, pSegment->writer.pBuffer, pSegment->writer.used);
+         return;
+     }
+     flushReport(pWriter); /* Keep the bytes in order */
+     if (!pWriter->failed && fwrite(pSegment->writer.pBuffer, 1, pSegment->writer.used, pWriter->pFile)
+                             != pSegment->writer.used) {
+         pWriter->failed = 1;
+     }
+ }
+ 
+ /**
+  * @brief Write the students of a list in one of the report layouts
+  * @param pWriter Pointer to the writer
+  * @param pList Pointer to the linked list
+  * @param format Report layout
+  * @param pDistribution GPA distribution appended to REPORT_FORMAT_TABLE, NULL to leave it out
+  */
+ void writeStudentReport(ReportWriter *pWriter, const LinkedList *pList, ReportFormat_TypeDef format,
+                         const GpaDistribution *pDistribution) {
+     putReportHeader(pWriter, format);
+     putStudentRows(pWriter, pList->pHead, SIZE_MAX, 1, format);
+     putReportFooter(pWriter, format, pDistribution);
+ }
+ 
+ /**
+  * @brief Write the rows of a roster view in one of the report layouts
+  * @param pWriter Pointer to the writer
+  * @param pView Pointer to the roster view
+  * @param format Report layout
+  */
+ void writeRosterViewReport(ReportWriter *pWriter, const RosterView *pView, ReportFormat_TypeDef format) {
+     putReportHeader(pWriter, format);
+     for (int row = 0; row < rosterViewCount(pView); row++) {
+         putStudentRow(pWriter, format, row + 1, rosterViewName(pView, row),
+                       rosterViewAge(pView, row), rosterViewGpa(pView, row));
+     }
+     putReportFooter(pWriter, format, NULL);
+ }
+ 
+ /**
+  * @brief Write a report with the rows formatted on several threads
+  * @param pWriter Pointer to the writer
+  * @param pList Pointer to the linked list, not modified while this runs
+  * @param format Report layout
+  * @param pDistribution GPA distribution appended to REPORT_FORMAT_TABLE, NULL to leave it out
+  * @param threadCount Number of threads, 0 for one per hardware thread
+  */
+ void writeStudentReportParallel(ReportWriter *pWriter, const LinkedList *pList, ReportFormat_TypeDef format,
+                                 const GpaDistribution *pDistribution, int threadCount) {
+     ReportSegment segments[MAX_WORKER_THREADS];
+     const Node *pNext = pList->pHead;
+     int number = 1;
+     if (threadCount <= 0) threadCount = hardwareThreadCount();
+     if (threadCount > MAX_WORKER_THREADS) threadCount = MAX_WORKER_THREADS;
+     if (threadCount < 2 || pList->nodeCount <= REPORT_SEGMENT_ROWS) {
+         writeStudentReport(pWriter, pList, format, pDistribution); /* Not worth the threads */
+         return;
+     }
+     for (int i = 0; i < threadCount; i++) {
+         initReportWriter(&segments[i].writer, NULL);
+         segments[i].format = format;
+     }
+     putReportHeader(pWriter, format);
+     while (pNext != NULL) {
+         int segmentCount = 0;
+         /* Cut the next threadCount * REPORT_SEGMENT_ROWS nodes into contiguous segments */
+         while (segmentCount < threadCount && pNext != NULL) {
+             ReportSegment *pSegment = &segments[segmentCount++];
+             pSegment->pFirst = pNext;
+             pSegment->firstNumber = number;
+             pSegment->rows = 0;
+             while (pNext != NULL && pSegment->rows < REPORT_SEGMENT_ROWS) {
+                 pNext = pNext->pNextNode;
+                 pSegment->rows++;
+             }
+             number += (int)pSegment->rows;
+         }
+         runWorkerTasks(formatReportSegment, segments, sizeof(segments[0]), segmentCount);
+         for (int i = 0; i < segmentCount; i++) putReportSegment(pWriter, &segments[i]);
+     }
+     putReportFooter(pWriter, format, pDistribution);
+     for (int i = 0; i < threadCount; i++) finishReportWriter(&segments[i].writer);
+ }
@@ -0,0 +1,150 @@
+/**
+ ******************************************************************************
+ * @file    reportwriter.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for the buffered student report writer
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef REPORTWRITER_H
+ #define REPORTWRITER_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include "linkedlist.h"
+ #include "StudentColumns.h"
+ #include "RosterView.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define REPORT_BUFFER_SIZE                  (1U << 20) /* Bytes formatted before each write */
+ #define REPORT_FALLBACK_SIZE                (4096U)    /* Inline buffer used if the big one can't be allocated */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Layout of a student report
+  */
+ typedef enum {
+     REPORT_FORMAT_CONSOLE,         /* Table printed by outputDataStudent */
+     REPORT_FORMAT_TABLE,           /* Boxed table written by saveToFile */
+     REPORT_FORMAT_CSV,             /* name,age,gpa with a header line */
+     REPORT_FORMAT_JSON_LINES       /* One {"name":..,"age":..,"gpa":..} object per line */
+ } ReportFormat_TypeDef;
+ 
+ /**
+  * @brief Output buffer flushed to a stream in large writes
+  */
+ typedef struct ReportWriter {
+     FILE *pFile;                   /* Destination stream */
+     char *pBuffer;                 /* Formatting buffer */
+     size_t used;                   /* Bytes waiting in pBuffer */
+     size_t capacity;               /* Size of pBuffer */
+     int failed;                    /* Set once a write fails */
+     char fallback[REPORT_FALLBACK_SIZE]; /* Used when pBuffer could not be allocated */
+ } ReportWriter;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Start writing to a stream
+  * @param pWriter Pointer to the writer
+  * @param pFile Destination stream, e.g. stdout or a file opened for writing,
+  *              or NULL to keep everything in a growing buffer
+  */
+ void initReportWriter(ReportWriter *pWriter, FILE *pFile);
+ 
+ /**
+  * @brief Flush what is left and release the buffer
+  * @param pWriter Pointer to the writer
+  * @return 1 if every write succeeded, 0 otherwise
+  * @note  The stream itself is flushed but not closed
+  */
+ int finishReportWriter(ReportWriter *pWriter);
+ 
+ /**
+  * @brief Append a string
+  * @param pWriter Pointer to the writer
+  * @param text Null-terminated text
+  */
+ void reportPutString(ReportWriter *pWriter, const char *text);
+ 
+ /**
+  * @brief Append a string left-justified in a field, like printf("%-*s")
+  * @param pWriter Pointer to the writer
+  * @param text Null-terminated text
+  * @param width Minimum field width
+  */
+ void reportPutPadded(ReportWriter *pWriter, const char *text, int width);
+ 
+ /**
+  * @brief Append an integer left-justified in a field, like printf("%-*d")
+  * @param pWriter Pointer to the writer
+  * @param value Value
+  * @param width Minimum field width, 0 for none
+  */
+ void reportPutInt(ReportWriter *pWriter, int value, int width);
+ 
+ /**
+  * @brief Append a value with two decimals left-justified in a field, like printf("%-*.2f")
+  * @param pWriter Pointer to the writer
+  * @param value Value
+  * @param width Minimum field width, 0 for none
+  * @note  Formatted without printf by rounding value * 100 to the nearest
+  *        integer, ties to even; fma recovers the product's rounding error so
+  *        the digits match a correctly rounding printf. Values of 1e13 and
+  *        above, infinities and NaN use snprintf.
+  */
+ void reportPutFixed2(ReportWriter *pWriter, double value, int width);
+ 
+ /**
+  * @brief Write the students of a list in one of the report layouts
+  * @param pWriter Pointer to the writer
+  * @param pList Pointer to the linked list
+  * @param format Report layout
+  * @param pDistribution GPA distribution appended to REPORT_FORMAT_TABLE, NULL to leave it out
+  */
+ void writeStudentReport(ReportWriter *pWriter, const LinkedList *pList, ReportFormat_TypeDef format,
+                         const GpaDistribution *pDistribution);
+ 
+ /**
+  * @brief Write the rows of a roster view in one of the report layouts
+  * @param pWriter Pointer to the writer
+  * @param pView Pointer to the roster view
+  * @param format Report layout
+  * @note  Rows come in the view's current order and are read in place
+  */
+ void writeRosterViewReport(ReportWriter *pWriter, const RosterView *pView, ReportFormat_TypeDef format);
+ 
+ /**
+  * @brief Write a report with the rows formatted on several threads
+  * @param pWriter Pointer to the writer
+  * @param pList Pointer to the linked list, not modified while this runs
+  * @param format Report layout
+  * @param pDistribution GPA distribution appended to REPORT_FORMAT_TABLE, NULL to leave it out
+  * @param threadCount Number of threads, 0 for one per hardware thread
+  * @note  The list is cut into contiguous segments on node boundaries, each
+  *        formatted by its own thread into its own buffer, and the buffers
+  *        are written in list order, so the output is byte-identical to
+  *        writeStudentReport. Segments are taken a round at a time to bound
+  *        the memory held. Small lists are written on the calling thread.
+  */
+ void writeStudentReportParallel(ReportWriter *pWriter, const LinkedList *pList, ReportFormat_TypeDef format,
+                                 const GpaDistribution *pDistribution, int threadCount);
+ 
+ #endif /* REPORTWRITER_H */
@@ -0,0 +1,449 @@
+/**
+ ******************************************************************************
+ * @file    rosterview.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of the memory-mapped read-only roster view
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+ #define _POSIX_C_SOURCE 200809L
+ #endif
+ #ifdef _WIN32
+ #include <windows.h>
+ #else
+ #include <fcntl.h>
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <unistd.h>
+ #endif
+ #include "RosterView.h"
+
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define VIEW_CHUNK_ROWS                     (1024U) /* Rows per validation or aggregate step */
+ #define VIEW_SMALL_RUN                      (16U)   /* Runs sorted by insertion before merging */
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Load a 32-bit little-endian value
+  * @param pIn Source bytes
+  * @return Value
+  */
+ static uint32_t readLe32(const unsigned char *pIn) {
+     return (uint32_t)pIn[0] | ((uint32_t)pIn[1] << 8) | ((uint32_t)pIn[2] << 16) | ((uint32_t)pIn[3] << 24);
+ }
+ 
+ /**
+  * @brief Get the bytes of a record by its number in the file
+  * @param pView Pointer to the view
+  * @param record Record number
+  * @return Pointer to ROSTER_RECORD_SIZE bytes inside the mapping
+  */
+ static const unsigned char* recordAt(const RosterView *pView, uint32_t record) {
+     return pView->pRecords + (size_t)record * ROSTER_RECORD_SIZE;
+ }
+ 
+ /**
+  * @brief Get the record number shown at a row
+  * @param pView Pointer to the view
+  * @param row Row index, 0-based
+  * @return Record number
+  */
+ static uint32_t recordOfRow(const RosterView *pView, int row) {
+     return (pView->pOrder != NULL) ? pView->pOrder[row] : (uint32_t)row;
+ }
+ 
+ /**
+  * @brief GPA stored in a record
+  * @param pRecord Record bytes
+  * @return GPA
+  */
+ static float recordGpa(const unsigned char *pRecord) {
+     uint32_t bits = readLe32(pRecord + ROSTER_NAME_SIZE + 4);
+     float gpa;
+     memcpy(&gpa, &bits, sizeof(gpa));
+     return gpa;
+ }
+ 
+ /**
+  * @brief Age stored in a record
+  * @param pRecord Record bytes
+  * @return Age
+  */
+ static int recordAge(const unsigned char *pRecord) {
+     return (int)readLe32(pRecord + ROSTER_NAME_SIZE);
+ }
+ 
+ /**
+  * @brief Map a whole file read-only with private (copy-on-write) pages
+  * @param pView Pointer to the view, receives pMap, mapSize and pageSize
+  * @param filename Name of the file
+  * @return NULL on success, otherwise an error message
+  */
+ static const char* mapRosterFile(RosterView *pView, const char *filename) {
+ #ifdef _WIN32
+     LARGE_INTEGER size;
+     SYSTEM_INFO info;
+     DWORD oldProtect;
+     HANDLE hFile = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+     if (hFile == INVALID_HANDLE_VALUE) return "Error opening file for reading.";
+     if (!GetFileSizeEx(hFile, &size) || size.QuadPart < ROSTER_HEADER_SIZE
+         || (unsigned long long)size.QuadPart > (unsigned long long)SIZE_MAX) {
+         CloseHandle(hFile);
+         return "Not a roster file!";
+     }
+     pView->hMapping = CreateFileMappingA(hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+     if (pView->hMapping == NULL) {
+         CloseHandle(hFile);
+         return "Error mapping file!";
+     }
+     pView->pMap = (unsigned char*)MapViewOfFile(pView->hMapping, FILE_MAP_COPY, 0, 0, 0);
+     if (pView->pMap == NULL) {
+         CloseHandle(pView->hMapping);
+         CloseHandle(hFile);
+         return "Error mapping file!";
+     }
+     pView->hFile = hFile;
+     pView->mapSize = (size_t)size.QuadPart;
+     VirtualProtect(pView->pMap, pView->mapSize, PAGE_READONLY, &oldProtect); /* Writable only once promoted */
+     GetSystemInfo(&info);
+     pView->pageSize = info.dwPageSize;
+ #else
+     struct stat info;
+     void *pMap;
+     int fd = open(filename, O_RDONLY);
+     if (fd < 0) return "Error opening file for reading.";
+     if (fstat(fd, &info) != 0 || info.st_size < (off_t)ROSTER_HEADER_SIZE
+         || (unsigned long long)info.st_size > (unsigned long long)SIZE_MAX) {
+         close(fd);
+         return "Not a roster file!";
+     }
+     pMap = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+     close(fd); /* The mapping keeps the file referenced */
+     if (pMap == MAP_FAILED) return "Error mapping file!";
+     pView->pMap = (unsigned char*)pMap;
+     pView->mapSize = (size_t)info.st_size;
+     pView->pageSize = (size_t)sysconf(_SC_PAGESIZE);
+ #endif
+     return NULL;
+ }
+ 
+ /**
+  * @brief Drop the mapping
+  * @param pView Pointer to the view
+  */
+ static void unmapRosterFile(RosterView *pView) {
+     if (pView->pMap == NULL) return;
+ #ifdef _WIN32
+     UnmapViewOfFile(pView->pMap);
+     CloseHandle(pView->hMapping);
+     CloseHandle(pView->hFile);
+ #else
+     munmap(pView->pMap, pView->mapSize);
+ #endif
+     pView->pMap = NULL;
+ }
+ 
+ /**
+  * @brief Change the protection of the pages covering a byte range
+  * @param pView Pointer to the view
+  * @param pStart First byte
+  * @param size Number of bytes
+  * @param writable 1 for private writable pages, 0 for read-only
+  * @return 1 on success, 0 on failure
+  */
+ static int protectRange(RosterView *pView, unsigned char *pStart, size_t size, int writable) {
+     size_t first = (size_t)(pStart - pView->pMap) / pView->pageSize * pView->pageSize;
+     size_t last = (size_t)(pStart - pView->pMap) + size;
+     size_t length = (last - first + pView->pageSize - 1) / pView->pageSize * pView->pageSize;
+ #ifdef _WIN32
+     DWORD oldProtect;
+     return VirtualProtect(pView->pMap + first, length, writable ? PAGE_WRITECOPY : PAGE_READONLY, &oldProtect) != 0;
+ #else
+     return mprotect(pView->pMap + first, length, writable ? (PROT_READ | PROT_WRITE) : PROT_READ) == 0;
+ #endif
+ }
+ 
+ /**
+  * @brief Map a binary roster file written by saveListBinary
+  * @param pView Pointer to the view
+  * @param filename Name of the file to map
+  * @return 1 on success, 0 on failure (a message is printed)
+  */
+ int openRosterView(RosterView *pView, const char *filename) {
+     RosterChecksum checksum = {0, 0};
+     uint64_t count = 0, storedChecksum = 0;
+     const char *error;
+ 
+     memset(pView, 0, sizeof(RosterView));
+     error = mapRosterFile(pView, filename);
+     if (error == NULL) {
+         error = checkRosterHeader(pView->pMap, &count, &storedChecksum);
+     }
+     if (error == NULL && (pView->mapSize - ROSTER_HEADER_SIZE) / ROSTER_RECORD_SIZE < count) {
+         error = "Roster file is truncated!";
+     }
+     if (error == NULL) {
+         pView->pRecords = pView->pMap + ROSTER_HEADER_SIZE;
+         pView->count = (int)count;
+ 
+         /* One pass: checksum each chunk and check its names while it is in cache */
+         for (uint32_t first = 0; error == NULL && first < count; first += VIEW_CHUNK_ROWS) {
+             uint32_t rows = ((uint32_t)count - first < VIEW_CHUNK_ROWS) ? (uint32_t)count - first : VIEW_CHUNK_ROWS;
+             updateRosterChecksum(&checksum, recordAt(pView, first), (size_t)rows * ROSTER_RECORD_SIZE);
+             for (uint32_t i = 0; i < rows; i++) {
+                 if (memchr(recordAt(pView, first + i), '\0', ROSTER_NAME_SIZE) == NULL) {
+                     error = "Roster file is corrupted!"; /* Unterminated name */
+                     break;
+                 }
+             }
+         }
+         if (error == NULL && finishRosterChecksum(&checksum) != storedChecksum) {
+             error = "Roster file is corrupted!";
+         }
+     }
+     if (error != NULL) {
+         printf("%s\n", error);
+         closeRosterView(pView);
+         return 0;
+     }
+     return 1;
+ }
+ 
+ /**
+  * @brief Unmap the file and free the row index
+  * @param pView Pointer to the view
+  */
+ void closeRosterView(RosterView *pView) {
+     unmapRosterFile(pView);
+     free(pView->pOrder);
+     memset(pView, 0, sizeof(RosterView));
+ }
+ 
+ /**
+  * @brief Get the number of rows
+  * @param pView Pointer to the view
+  * @return Number of rows
+  */
+ int rosterViewCount(const RosterView *pView) {
+     return pView->count;
+ }
+ 
+ /**
+  * @brief Get the name of a row without copying it
+  * @param pView Pointer to the view
+  * @param row Row index, 0-based
+  * @return Null-terminated name inside the mapping
+  */
+ const char* rosterViewName(const RosterView *pView, int row) {
+     return (const char*)recordAt(pView, recordOfRow(pView, row));
+ }
+ 
+ /**
+  * @brief Get the age of a row
+  * @param pView Pointer to the view
+  * @param row Row index, 0-based
+  * @return Age
+  */
+ int rosterViewAge(const RosterView *pView, int row) {
+     return recordAge(recordAt(pView, recordOfRow(pView, row)));
+ }
+ 
+ /**
+  * @brief Get the GPA of a row
+  * @param pView Pointer to the view
+  * @param row Row index, 0-based
+  * @return GPA
+  */
+ float rosterViewGpa(const RosterView *pView, int row) {
+     return recordGpa(recordAt(pView, recordOfRow(pView, row)));
+ }
+ 
+ /**
+  * @brief Compare two records by several keys, reading the fields in place
+  * @param pView Pointer to the view
+  * @param a First record number
+  * @param b Second record number
+  * @param keys Sort keys
+  * @param nkeys Number of keys
+  * @return Negative if a sorts first, positive if b sorts first, 0 if equal
+  */
+ static int compareViewRecords(const RosterView *pView, uint32_t a, uint32_t b, const SortKey *keys, int nkeys) {
+     const unsigned char *pA = recordAt(pView, a);
+     const unsigned char *pB = recordAt(pView, b);
+     for (int k = 0; k < nkeys; k++) {
+         int cmp;
+         if (keys[k].field == SORT_FIELD_NAME) {
+             cmp = strcmp((const char*)pA, (const char*)pB);
+         } else if (keys[k].field == SORT_FIELD_AGE) {
+             int ageA = recordAge(pA), ageB = recordAge(pB);
+             cmp = (ageA > ageB) - (ageA < ageB);
+         } else {
+             float gpaA = recordGpa(pA), gpaB = recordGpa(pB);
+             cmp = (gpaA > gpaB) - (gpaA < gpaB);
+         }
+         if (cmp != 0) return (keys[k].direction == SORT_DESCENDING) ? -cmp : cmp;
+     }
+     return 0;
+ }
+ 
+ /**
+  * @brief Sort the rows of the view by several keys
+  * @param pView Pointer to the view
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys
+  * @return 1 on success, 0 on invalid keys or out of memory (a message is printed)
+  */
+ int rosterViewSort(RosterView *pView, const SortKey *keys, int nkeys) {
+     size_t count = (size_t)pView->count;
+     uint32_t *pSource, *pTarget;
+ 
+     if (keys == NULL || nkeys < 1) {
+         printf("Invalid sort keys!\n");
+         return 0;
+     }
+     for (int k = 0; k < nkeys; k++) {
+         if ((unsigned int)keys[k].field > SORT_FIELD_GPA || (unsigned int)keys[k].direction > SORT_DESCENDING) {
+             printf("Invalid sort keys!\n");
+             return 0;
+         }
+     }
+     if (count < 2) return 1;
+     if (pView->pOrder == NULL) {
+         pView->pOrder = (uint32_t*)malloc(count * sizeof(uint32_t));
+         if (pView->pOrder == NULL) {
+             printf("Memory allocation failed!\n");
+             return 0;
+         }
+         for (size_t i = 0; i < count; i++) pView->pOrder[i] = (uint32_t)i;
+     }
+     pTarget = (uint32_t*)malloc(count * sizeof(uint32_t));
+     if (pTarget == NULL) {
+         printf("Memory allocation failed!\n");
+         return 0;
+     }
+     pSource = pView->pOrder;
+ 
+     /* Insertion sort short runs, then merge pairs of runs back and forth */
+     for (size_t start = 0; start < count; start += VIEW_SMALL_RUN) {
+         size_t end = (start + VIEW_SMALL_RUN < count) ? start + VIEW_SMALL_RUN : count;
+         for (size_t i = start + 1; i < end; i++) {
+             uint32_t record = pSource[i];
+             size_t j = i;
+             while (j > start && compareViewRecords(pView, pSource[j - 1], record, keys, nkeys) > 0) {
+                 pSource[j] = pSource[j - 1];
+                 j--;
+             }
+             pSource[j] = record;
+         }
+     }
+     for (size_t width = VIEW_SMALL_RUN; width < count; width *= 2) {
+         uint32_t *pSwap;
+         for (size_t left = 0; left < count; left += 2 * width) {
+             size_t mid = (left + width < count) ? left + width : count;
+             size_t right = (mid + width < count) ? mid + width : count;
+             size_t i = left, j = mid, out = left;
+             while (i < mid && j < right) {
+                 /* Take from the left run on ties to stay stable */
+                 if (compareViewRecords(pView, pSource[j], pSource[i], keys, nkeys) < 0) {
+                     pTarget[out++] = pSource[j++];
+                 } else {
+                     pTarget[out++] = pSource[i++];
+                 }
+             }
+             while (i < mid) pTarget[out++] = pSource[i++];
+             while (j < right) pTarget[out++] = pSource[j++];
+         }
+         pSwap = pSource;
+         pSource = pTarget;
+         pTarget = pSwap;
+     }
+     pView->pOrder = pSource;
+     free(pTarget);
+     return 1;
+ }
+ 
+ /**
+  * @brief Compute GPA bands, sums, min and max of GPA and age over all rows
+  * @param pView Pointer to the view
+  * @param pResult Receives the aggregates
+  */
+ void rosterViewAggregate(const RosterView *pView, StudentAggregates *pResult) {
+     float gpa[VIEW_CHUNK_ROWS];
+     int age[VIEW_CHUNK_ROWS];
+     memset(pResult, 0, sizeof(StudentAggregates));
+ 
+     /* Gather the two fields of a chunk (8 bytes per record) and run the vector kernel */
+     for (uint32_t first = 0; first < (uint32_t)pView->count; first += VIEW_CHUNK_ROWS) {
+         uint32_t rows = ((uint32_t)pView->count - first < VIEW_CHUNK_ROWS) ? (uint32_t)pView->count - first : VIEW_CHUNK_ROWS;
+         StudentAggregates chunk;
+         for (uint32_t i = 0; i < rows; i++) {
+             const unsigned char *pRecord = recordAt(pView, first + i); /* File order: bands don't depend on it */
+             gpa[i] = recordGpa(pRecord);
+             age[i] = recordAge(pRecord);
+         }
+         aggregateColumns(gpa, age, rows, &chunk);
+         if (first == 0) {
+             *pResult = chunk;
+             continue;
+         }
+         pResult->count += chunk.count;
+         pResult->excellent += chunk.excellent;
+         pResult->good += chunk.good;
+         pResult->average += chunk.average;
+         pResult->weak += chunk.weak;
+         pResult->gpaSum += chunk.gpaSum;
+         pResult->ageSum += chunk.ageSum;
+         if (chunk.gpaMin < pResult->gpaMin) pResult->gpaMin = chunk.gpaMin;
+         if (chunk.gpaMax > pResult->gpaMax) pResult->gpaMax = chunk.gpaMax;
+         if (chunk.ageMin < pResult->ageMin) pResult->ageMin = chunk.ageMin;
+         if (chunk.ageMax > pResult->ageMax) pResult->ageMax = chunk.ageMax;
+     }
+ }
+ 
+ /**
+  * @brief Replace the student at a specific position
+  * @param pView Pointer to the view
+  * @param position Position of the student to edit, 1-based
+  * @param newStudent New student data
+  * @return 1 on success, 0 on failure (a message is printed)
+  */
+ int rosterViewEditPosition(RosterView *pView, int position, Student newStudent) {
+     unsigned char *pRecord;
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return 0;
+     }
+     if (position > pView->count) {
+         printf("Position out of range!\n");
+         return 0;
+     }
+     pRecord = pView->pRecords + (size_t)recordOfRow(pView, position - 1) * ROSTER_RECORD_SIZE;
+     if (!protectRange(pView, pRecord, ROSTER_RECORD_SIZE, 1)) {
+         printf("Memory allocation failed!\n");
+         return 0;
+     }
+     packRosterRecord(pRecord, &newStudent); /* First write copies the page privately */
+     protectRange(pView, pRecord, ROSTER_RECORD_SIZE, 0);
+     pView->promotedRecords++;
+     return 1;
+ }
@@ -0,0 +1,130 @@
+/**
+ ******************************************************************************
+ * @file    rosterview.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for the memory-mapped read-only roster view
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef ROSTERVIEW_H
+ #define ROSTERVIEW_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include "linkedlist.h"
+ #include "ColumnKernels.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Binary roster file mapped into memory and read in place
+  * @note  Rows are addressed through pOrder, an index of record numbers, so
+  *        sorting a view moves 4-byte entries and never the records. Pages stay
+  *        read-only until an edit promotes them to private copy-on-write pages;
+  *        the file itself is never written.
+  */
+ typedef struct RosterView {
+     unsigned char *pMap;       /* Start of the mapping */
+     size_t mapSize;            /* Bytes mapped */
+     unsigned char *pRecords;   /* First record, right after the header */
+     int count;                 /* Number of records */
+     uint32_t *pOrder;          /* Record number of each row, NULL while in file order */
+     size_t pageSize;           /* Granularity of copy-on-write promotion */
+     int promotedRecords;       /* Records edited since the view was opened */
+ #ifdef _WIN32
+     void *hFile;               /* File handle */
+     void *hMapping;            /* File mapping handle */
+ #endif
+ } RosterView;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Map a binary roster file written by saveListBinary
+  * @param pView Pointer to the view
+  * @param filename Name of the file to map
+  * @return 1 on success, 0 on failure (a message is printed)
+  * @note  The header, checksum and name terminators are checked once here, so
+  *        the accessors can hand out pointers into the mapping
+  */
+ int openRosterView(RosterView *pView, const char *filename);
+ 
+ /**
+  * @brief Unmap the file and free the row index
+  * @param pView Pointer to the view
+  */
+ void closeRosterView(RosterView *pView);
+ 
+ /**
+  * @brief Get the number of rows
+  * @param pView Pointer to the view
+  * @return Number of rows
+  */
+ int rosterViewCount(const RosterView *pView);
+ 
+ /**
+  * @brief Get the name of a row without copying it
+  * @param pView Pointer to the view
+  * @param row Row index, 0-based
+  * @return Null-terminated name inside the mapping
+  */
+ const char* rosterViewName(const RosterView *pView, int row);
+ 
+ /**
+  * @brief Get the age of a row
+  * @param pView Pointer to the view
+  * @param row Row index, 0-based
+  * @return Age
+  */
+ int rosterViewAge(const RosterView *pView, int row);
+ 
+ /**
+  * @brief Get the GPA of a row
+  * @param pView Pointer to the view
+  * @param row Row index, 0-based
+  * @return GPA
+  */
+ float rosterViewGpa(const RosterView *pView, int row);
+ 
+ /**
+  * @brief Sort the rows of the view by several keys
+  * @param pView Pointer to the view
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys
+  * @return 1 on success, 0 on invalid keys or out of memory (a message is printed)
+  * @note  Stable, like sortList; only the row index is reordered
+  */
+ int rosterViewSort(RosterView *pView, const SortKey *keys, int nkeys);
+ 
+ /**
+  * @brief Compute GPA bands, sums, min and max of GPA and age over all rows
+  * @param pView Pointer to the view
+  * @param pResult Receives the aggregates
+  */
+ void rosterViewAggregate(const RosterView *pView, StudentAggregates *pResult);
+ 
+ /**
+  * @brief Replace the student at a specific position
+  * @param pView Pointer to the view
+  * @param position Position of the student to edit, 1-based
+  * @param newStudent New student data
+  * @return 1 on success, 0 on failure (a message is printed)
+  * @note  Only the pages holding the record are promoted to private copies
+  */
+ int rosterViewEditPosition(RosterView *pView, int position, Student newStudent);
+ 
+ #endif /* ROSTERVIEW_H */
@@ -0,0 +1,416 @@
+/**
+ ******************************************************************************
+ * @file    sortednodes.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of node pointers kept sorted in blocks
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include "SortedNodes.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Node with its packed key, one row of a rebuild
+  */
+ typedef struct KeyedNode {
+     uint64_t key;                  /* Packed key of the node */
+     Node *pNode;                   /* Node the key was taken from */
+ } KeyedNode;
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Get the last node of a block
+  * @param pBlock Block, not empty
+  * @return Its last node
+  */
+ static const Node* lastNode(const SortedBlock *pBlock) {
+     return pBlock->pNodes[pBlock->count - 1];
+ }
+ 
+ /**
+  * @brief Find the first block whose last node does not sort before a node
+  * @param pSet Pointer to the set
+  * @param pNode Node to place
+  * @return Block number, blockCount if there is none
+  */
+ static size_t findBlock(const SortedNodes *pSet, const Node *pNode) {
+     size_t lo = 0;
+     size_t hi = pSet->blockCount;
+     while (lo < hi) {
+         size_t mid = lo + (hi - lo) / 2;
+         if (pSet->order(lastNode(pSet->ppBlocks[mid]), pNode) < 0) {
+             lo = mid + 1;
+         } else {
+             hi = mid;
+         }
+     }
+     return lo;
+ }
+ 
+ /**
+  * @brief Find the first slot of a block that does not sort before a node
+  * @param pSet Pointer to the set
+  * @param pBlock Block
+  * @param pNode Node to place
+  * @return Slot number, count if there is none
+  */
+ static int findSlot(const SortedNodes *pSet, const SortedBlock *pBlock, const Node *pNode) {
+     int lo = 0;
+     int hi = pBlock->count;
+     while (lo < hi) {
+         int mid = lo + (hi - lo) / 2;
+         if (pSet->order(pBlock->pNodes[mid], pNode) < 0) {
+             lo = mid + 1;
+         } else {
+             hi = mid;
+         }
+     }
+     return lo;
+ }
+ 
+ /**
+  * @brief Insert an empty block into the directory
+  * @param pSet Pointer to the set
+  * @param at Block number it takes
+  * @return The block, or NULL if out of memory
+  */
+ static SortedBlock* insertBlock(SortedNodes *pSet, size_t at) {
+     SortedBlock *pBlock;
+     if (pSet->blockCount == pSet->blockCapacity) {
+         size_t capacity = (pSet->blockCapacity != 0) ? pSet->blockCapacity * 2 : 16;
+         SortedBlock **ppBlocks = (SortedBlock**)realloc(pSet->ppBlocks, capacity * sizeof(SortedBlock*));
+         if (ppBlocks == NULL) return NULL;
+         pSet->ppBlocks = ppBlocks;
+         pSet->blockCapacity = capacity;
+     }
+     pBlock = (SortedBlock*)malloc(sizeof(SortedBlock));
+     if (pBlock == NULL) return NULL;
+     pBlock->count = 0;
+     memmove(&pSet->ppBlocks[at + 1], &pSet->ppBlocks[at], (pSet->blockCount - at) * sizeof(SortedBlock*));
+     pSet->ppBlocks[at] = pBlock;
+     pSet->blockCount++;
+     return pBlock;
+ }
+ 
+ /**
+  * @brief Free every block
+  * @param pSet Pointer to the set
+  */
+ static void freeBlocks(SortedNodes *pSet) {
+     for (size_t i = 0; i < pSet->blockCount; i++) free(pSet->ppBlocks[i]);
+     pSet->blockCount = 0;
+ }
+ 
+ /**
+  * @brief Initialize an empty set, marked dirty until built
+  * @param pSet Pointer to the set
+  * @param order Order of the nodes
+  * @param key Same order packed in an integer, NULL if it does not fit
+  */
+ void initSortedNodes(SortedNodes *pSet, NodeOrder_TypeDef order, NodeKey_TypeDef key) {
+     pSet->ppBlocks = NULL;
+     pSet->blockCount = 0;
+     pSet->blockCapacity = 0;
+     pSet->order = order;
+     pSet->key = key;
+     pSet->dirty = 1; /* Nothing sorted yet */
+ }
+ 
+ /**
+  * @brief Free the blocks of a set
+  * @param pSet Pointer to the set
+  */
+ void freeSortedNodes(SortedNodes *pSet) {
+     freeBlocks(pSet);
+     free(pSet->ppBlocks);
+     pSet->ppBlocks = NULL;
+     pSet->blockCapacity = 0;
+     pSet->dirty = 1;
+ }
+ 
+ /**
+  * @brief Order keyed nodes by key
+  * @param pA First keyed node
+  * @param pB Second keyed node
+  * @return Negative, zero or positive as for qsort
+  */
+ static int compareKeyedNodes(const void *pA, const void *pB) {
+     uint64_t a = ((const KeyedNode*)pA)->key;
+     uint64_t b = ((const KeyedNode*)pB)->key;
+     return (a > b) - (a < b);
+ }
+ 
+ /**
+  * @brief Merge two sorted runs of node pointers
+  * @param order Order of the nodes
+  * @param ppLeft First run
+  * @param nLeft Length of the first run
+  * @param ppRight Second run
+  * @param nRight Length of the second run
+  * @param ppOut Receives nLeft + nRight pointers
+  */
+ static void mergeRuns(NodeOrder_TypeDef order, Node **ppLeft, size_t nLeft, Node **ppRight, size_t nRight, Node **ppOut) {
+     size_t i = 0;
+     size_t j = 0;
+     while (i < nLeft && j < nRight) {
+         *ppOut++ = (order(ppRight[j], ppLeft[i]) < 0) ? ppRight[j++] : ppLeft[i++];
+     }
+     while (i < nLeft) *ppOut++ = ppLeft[i++];
+     while (j < nRight) *ppOut++ = ppRight[j++];
+ }
+ 
+ /**
+  * @brief Sort keyed nodes by key, one radix pass per SORTED_RADIX_BITS bits
+  * @param pKeyed Keyed nodes
+  * @param pBuffer Scratch space of the same length
+  * @param count Number of keyed nodes
+  * @return pKeyed or pBuffer, whichever holds the sorted rows, or NULL if out of memory
+  */
+ static KeyedNode* radixSortKeyed(KeyedNode *pKeyed, KeyedNode *pBuffer, size_t count) {
+     size_t buckets = (size_t)1 << SORTED_RADIX_BITS;
+     size_t *pCounts = (size_t*)malloc(buckets * sizeof(size_t));
+     if (pCounts == NULL) return NULL;
+     for (unsigned int shift = 0; shift < 64; shift += SORTED_RADIX_BITS) {
+         size_t sum = 0;
+         KeyedNode *pSwap;
+         memset(pCounts, 0, buckets * sizeof(size_t));
+         for (size_t i = 0; i < count; i++) pCounts[(pKeyed[i].key >> shift) & (buckets - 1)]++;
+         if (pCounts[(pKeyed[0].key >> shift) & (buckets - 1)] == count) continue; /* Every key has this digit */
+         for (size_t b = 0; b < buckets; b++) {
+             size_t n = pCounts[b];
+             pCounts[b] = sum;
+             sum += n;
+         }
+         for (size_t i = 0; i < count; i++) pBuffer[pCounts[(pKeyed[i].key >> shift) & (buckets - 1)]++] = pKeyed[i];
+         pSwap = pKeyed;
+         pKeyed = pBuffer;
+         pBuffer = pSwap;
+     }
+     free(pCounts);
+     return pKeyed;
+ }
+ 
+ /**
+  * @brief Sort nodes by packed key
+  * @param pSet Pointer to the set, with a key
+  * @param ppNodes Nodes to sort, overwritten with the result
+  * @param count Number of nodes
+  * @return 1 on success, 0 if out of memory
+  */
+ static int sortByKey(const SortedNodes *pSet, Node **ppNodes, size_t count) {
+     KeyedNode *pKeyed = (KeyedNode*)malloc(2 * count * sizeof(KeyedNode));
+     KeyedNode *pSorted = pKeyed;
+     if (pKeyed == NULL) return 0;
+     for (size_t i = 0; i < count; i++) { /* Independent loads, unlike a walk of the chain */
+         pKeyed[i].key = pSet->key(ppNodes[i]);
+         pKeyed[i].pNode = ppNodes[i];
+     }
+     if (count >= SORTED_RADIX_MIN_NODES) {
+         pSorted = radixSortKeyed(pKeyed, pKeyed + count, count);
+     } else {
+         qsort(pKeyed, count, sizeof(KeyedNode), compareKeyedNodes);
+     }
+     if (pSorted != NULL) {
+         for (size_t i = 0; i < count; i++) ppNodes[i] = pSorted[i].pNode;
+     }
+     free(pKeyed);
+     return pSorted != NULL;
+ }
+ 
+ /**
+  * @brief Sort nodes by the order of a set, merging runs bottom-up
+  * @param pSet Pointer to the set
+  * @param ppNodes Nodes to sort, overwritten with the result
+  * @param count Number of nodes
+  * @return 1 on success, 0 if out of memory
+  * @note  qsort has no way to pass the order to its callback
+  */
+ static int sortByOrder(const SortedNodes *pSet, Node **ppNodes, size_t count) {
+     Node **ppBuffer = (Node**)malloc(count * sizeof(Node*));
+     Node **ppFrom = ppNodes;
+     Node **ppTo = ppBuffer;
+     if (ppBuffer == NULL) return 0;
+     for (size_t width = 1; width < count; width *= 2) {
+         Node **ppSwap;
+         for (size_t left = 0; left < count; left += 2 * width) {
+             size_t mid = (left + width < count) ? left + width : count;
+             size_t right = (mid + width < count) ? mid + width : count;
+             mergeRuns(pSet->order, &ppFrom[left], mid - left, &ppFrom[mid], right - mid, &ppTo[left]);
+         }
+         ppSwap = ppFrom;
+         ppFrom = ppTo;
+         ppTo = ppSwap;
+     }
+     if (ppFrom != ppNodes) memcpy(ppNodes, ppFrom, count * sizeof(Node*));
+     free(ppBuffer);
+     return 1;
+ }
+ 
+ /**
+  * @brief Rebuild a set from the nodes of a list
+  * @param pSet Pointer to the set
+  * @param ppNodes Every node of the list, in list order
+  * @param count Number of nodes
+  * @return 1 on success, 0 if out of memory (the set stays dirty)
+  */
+ int sortedNodesRebuild(SortedNodes *pSet, Node *const *ppNodes, size_t count) {
+     Node **ppSorted = NULL;
+     freeBlocks(pSet); /* Their nodes may be gone already */
+     pSet->dirty = 1;
+     if (count != 0) {
+         int sorted;
+         ppSorted = (Node**)malloc(count * sizeof(Node*));
+         if (ppSorted == NULL) return 0;
+         memcpy(ppSorted, ppNodes, count * sizeof(Node*));
+         sorted = (pSet->key != NULL) ? sortByKey(pSet, ppSorted, count) : sortByOrder(pSet, ppSorted, count);
+         if (!sorted) {
+             free(ppSorted);
+             return 0;
+         }
+     }
+     for (size_t i = 0; i < count; ) {
+         SortedBlock *pBlock = insertBlock(pSet, pSet->blockCount);
+         if (pBlock == NULL) {
+             freeBlocks(pSet);
+             free(ppSorted);
+             return 0;
+         }
+         for (; i < count && pBlock->count < (int)SORTED_BLOCK_FILL; i++) pBlock->pNodes[pBlock->count++] = ppSorted[i];
+     }
+     free(ppSorted);
+     pSet->dirty = 0;
+     return 1;
+ }
+ 
+ /**
+  * @brief Add a node that was just linked
+  * @param pSet Pointer to the set
+  * @param pNode Node, with its final keys and label
+  * @return 1 on success, 0 if out of memory (the set is marked dirty)
+  */
+ int sortedNodesAdd(SortedNodes *pSet, Node *pNode) {
+     SortedBlock *pBlock;
+     size_t block;
+     int slot;
+     if (pSet->dirty) return 1; /* Picked up by the rebuild */
+     if (pSet->blockCount == 0) { /* First node: no last node to search by yet */
+         pBlock = insertBlock(pSet, 0);
+         if (pBlock == NULL) {
+             pSet->dirty = 1;
+             return 0;
+         }
+         pBlock->pNodes[pBlock->count++] = pNode;
+         return 1;
+     }
+     block = findBlock(pSet, pNode);
+     if (block == pSet->blockCount) block--; /* Sorts last: end of the last block */
+     pBlock = pSet->ppBlocks[block];
+     slot = findSlot(pSet, pBlock, pNode);
+     if (slot < pBlock->count && pBlock->pNodes[slot] == pNode) return 1; /* In the set already */
+     if (pBlock->count == (int)SORTED_BLOCK_NODES) { /* Full: move the upper half to a new block */
+         int half = (int)SORTED_BLOCK_NODES / 2;
+         SortedBlock *pUpper = insertBlock(pSet, block + 1);
+         if (pUpper == NULL) {
+             pSet->dirty = 1;
+             return 0;
+         }
+         memcpy(pUpper->pNodes, &pBlock->pNodes[half], (size_t)(pBlock->count - half) * sizeof(Node*));
+         pUpper->count = pBlock->count - half;
+         pBlock->count = half;
+         if (slot > half) {
+             pBlock = pUpper;
+             slot -= half;
+         }
+     }
+     memmove(&pBlock->pNodes[slot + 1], &pBlock->pNodes[slot], (size_t)(pBlock->count - slot) * sizeof(Node*));
+     pBlock->pNodes[slot] = pNode;
+     pBlock->count++;
+     return 1;
+ }
+ 
+ /**
+  * @brief Remove a node that is being unlinked or changed
+  * @param pSet Pointer to the set
+  * @param pNode Node, still holding the keys and label it was added with
+  */
+ void sortedNodesRemove(SortedNodes *pSet, const Node *pNode) {
+     size_t block;
+     SortedBlock *pBlock;
+     int slot;
+     if (pSet->dirty) return;
+     block = findBlock(pSet, pNode);
+     if (block == pSet->blockCount) return;
+     pBlock = pSet->ppBlocks[block];
+     slot = findSlot(pSet, pBlock, pNode);
+     if (slot == pBlock->count || pBlock->pNodes[slot] != pNode) return; /* Not in the set */
+     memmove(&pBlock->pNodes[slot], &pBlock->pNodes[slot + 1], (size_t)(pBlock->count - slot - 1) * sizeof(Node*));
+     if (--pBlock->count == 0) { /* Keep no empty block: lookups read the last node */
+         free(pBlock);
+         memmove(&pSet->ppBlocks[block], &pSet->ppBlocks[block + 1], (pSet->blockCount - block - 1) * sizeof(SortedBlock*));
+         pSet->blockCount--;
+     }
+ }
+ 
+ /**
+  * @brief Find the first node that does not sort before a key
+  * @param pSet Pointer to the set, not dirty
+  * @param below Test of a node against the key; false from some node on
+  * @param pKey Search key
+  * @return Cursor on that node, or past the last node
+  */
+ SortedCursor sortedNodesSeek(const SortedNodes *pSet, NodeBelow_TypeDef below, const void *pKey) {
+     SortedCursor cursor = { 0, 0 };
+     size_t hiBlock = pSet->blockCount;
+     int hi;
+     while (cursor.block < hiBlock) {
+         size_t mid = cursor.block + (hiBlock - cursor.block) / 2;
+         if (below(lastNode(pSet->ppBlocks[mid]), pKey)) {
+             cursor.block = mid + 1;
+         } else {
+             hiBlock = mid;
+         }
+     }
+     if (cursor.block == pSet->blockCount) return cursor;
+     hi = pSet->ppBlocks[cursor.block]->count;
+     while (cursor.slot < hi) {
+         int mid = cursor.slot + (hi - cursor.slot) / 2;
+         if (below(pSet->ppBlocks[cursor.block]->pNodes[mid], pKey)) {
+             cursor.slot = mid + 1;
+         } else {
+             hi = mid;
+         }
+     }
+     return cursor;
+ }
+ 
+ /**
+  * @brief Get the node under a cursor, stepping to the next block when needed
+  * @param pSet Pointer to the set
+  * @param pCursor Cursor, moved onto a valid slot; advance with pCursor->slot++
+  * @return The node, or NULL past the last one
+  */
+ Node* sortedNodesAt(const SortedNodes *pSet, SortedCursor *pCursor) {
+     while (pCursor->block < pSet->blockCount && pCursor->slot >= pSet->ppBlocks[pCursor->block]->count) {
+         pCursor->block++;
+         pCursor->slot = 0;
+     }
+     return (pCursor->block < pSet->blockCount) ? pSet->ppBlocks[pCursor->block]->pNodes[pCursor->slot] : NULL;
+ }
@@ -0,0 +1,158 @@
+/**
+ ******************************************************************************
+ * @file    sortednodes.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for node pointers kept sorted in blocks
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef SORTEDNODES_H
+ #define SORTEDNODES_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include "linkedlist.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define SORTED_BLOCK_NODES                  (256U) /* Node pointers per block */
+ #define SORTED_BLOCK_FILL                   (192U) /* Pointers per block after a rebuild, room for inserts */
+ #define SORTED_RADIX_BITS                   (16U)  /* Key bits per radix pass */
+ #define SORTED_RADIX_MIN_NODES              (4096U) /* Fewest nodes worth a radix sort, qsort below */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Order of two nodes in a sorted set
+  * @param pA First node
+  * @param pB Second node
+  * @return Negative, zero or positive as for strcmp, zero only for the same node
+  */
+ typedef int (*NodeOrder_TypeDef)(const Node *pA, const Node *pB);
+ 
+ /**
+  * @brief Check whether a node sorts before a search key
+  * @param pNode Node
+  * @param pKey Search key
+  * @return Non-zero if the node sorts before the key
+  */
+ typedef int (*NodeBelow_TypeDef)(const Node *pNode, const void *pKey);
+ 
+ /**
+  * @brief Pack a node's place in a sorted set into one integer
+  * @param pNode Node
+  * @return Key that orders nodes exactly as the set's order does
+  */
+ typedef uint64_t (*NodeKey_TypeDef)(const Node *pNode);
+ 
+ /**
+  * @brief Sorted run of node pointers
+  */
+ typedef struct SortedBlock {
+     int count;                              /* Pointers in use */
+     Node *pNodes[SORTED_BLOCK_NODES];       /* Nodes in order */
+ } SortedBlock;
+ 
+ /**
+  * @brief Node pointers sorted by a total order, in blocks
+  * @note  Keys are read from the nodes themselves, so the set holds no copy
+  *        of them. A lookup binary-searches the blocks by their last node,
+  *        then one block; an insert or delete moves at most one block's
+  *        pointers. The order must tell every pair of nodes apart, for
+  *        instance by ending on the list order labels.
+  */
+ typedef struct SortedNodes {
+     SortedBlock **ppBlocks;                 /* Blocks in order, none empty */
+     size_t blockCount;                      /* Blocks in use */
+     size_t blockCapacity;                   /* Size of ppBlocks */
+     NodeOrder_TypeDef order;                /* Order of the nodes */
+     NodeKey_TypeDef key;                    /* Same order packed in an integer, NULL if it does not fit */
+     int dirty;                              /* Out of step with the list, rebuild before use */
+ } SortedNodes;
+ 
+ /**
+  * @brief Place in a sorted set
+  */
+ typedef struct SortedCursor {
+     size_t block;                           /* Block number */
+     int slot;                               /* Slot in the block */
+ } SortedCursor;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Initialize an empty set, marked dirty until built
+  * @param pSet Pointer to the set
+  * @param order Order of the nodes
+  * @param key Same order packed in an integer, NULL if it does not fit
+  */
+ void initSortedNodes(SortedNodes *pSet, NodeOrder_TypeDef order, NodeKey_TypeDef key);
+ 
+ /**
+  * @brief Free the blocks of a set
+  * @param pSet Pointer to the set
+  */
+ void freeSortedNodes(SortedNodes *pSet);
+ 
+ /**
+  * @brief Rebuild a set from the nodes of a list
+  * @param pSet Pointer to the set
+  * @param ppNodes Every node of the list, in list order
+  * @param count Number of nodes
+  * @return 1 on success, 0 if out of memory (the set stays dirty)
+  * @note  With a packed key, a radix sort that reads each node once;
+  *        otherwise an O(n log n) merge sort that reads the nodes on every
+  *        compare.
+  */
+ int sortedNodesRebuild(SortedNodes *pSet, Node *const *ppNodes, size_t count);
+ 
+ /**
+  * @brief Add a node that was just linked
+  * @param pSet Pointer to the set
+  * @param pNode Node, with its final keys and label
+  * @return 1 on success, 0 if out of memory (the set is marked dirty)
+  * @note  Does nothing if the node is in the set already
+  */
+ int sortedNodesAdd(SortedNodes *pSet, Node *pNode);
+ 
+ /**
+  * @brief Remove a node that is being unlinked or changed
+  * @param pSet Pointer to the set
+  * @param pNode Node, still holding the keys and label it was added with
+  * @note  Does nothing if the node is not in the set
+  */
+ void sortedNodesRemove(SortedNodes *pSet, const Node *pNode);
+ 
+ /**
+  * @brief Find the first node that does not sort before a key
+  * @param pSet Pointer to the set, not dirty
+  * @param below Test of a node against the key; false from some node on
+  * @param pKey Search key
+  * @return Cursor on that node, or past the last node
+  */
+ SortedCursor sortedNodesSeek(const SortedNodes *pSet, NodeBelow_TypeDef below, const void *pKey);
+ 
+ /**
+  * @brief Get the node under a cursor, stepping to the next block when needed
+  * @param pSet Pointer to the set
+  * @param pCursor Cursor, moved onto a valid slot; advance with pCursor->slot++
+  * @return The node, or NULL past the last one
+  */
+ Node* sortedNodesAt(const SortedNodes *pSet, SortedCursor *pCursor);
+ 
+ #endif /* SORTEDNODES_H */
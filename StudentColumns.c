@@ -0,0 +1,209 @@
+/**
+ ******************************************************************************
+ * @file    studentcolumns.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of the columnar student snapshot and its aggregates
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include "StudentColumns.h"
+
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Make room for more rows and name bytes
+  * @param pColumns Pointer to the snapshot
+  * @param rows Rows needed in total
+  * @param nameBytes Name bytes needed in total
+  * @return 1 on success, 0 if out of memory
+  */
+ static int reserveColumns(StudentColumns *pColumns, size_t rows, size_t nameBytes) {
+     if (rows > pColumns->capacity) {
+         size_t capacity = (pColumns->capacity != 0) ? pColumns->capacity : 64;
+         while (capacity < rows) capacity *= 2;
+         float *pGpa = (float*)realloc(pColumns->gpa, capacity * sizeof(float));
+         if (pGpa == NULL) return 0;
+         pColumns->gpa = pGpa;
+         int *pAge = (int*)realloc(pColumns->age, capacity * sizeof(int));
+         if (pAge == NULL) return 0;
+         pColumns->age = pAge;
+         uint32_t *pOffset = (uint32_t*)realloc(pColumns->nameOffset, capacity * sizeof(uint32_t));
+         if (pOffset == NULL) return 0;
+         pColumns->nameOffset = pOffset;
+         pColumns->capacity = capacity;
+     }
+     if (nameBytes > pColumns->nameCapacity) {
+         size_t capacity = (pColumns->nameCapacity != 0) ? pColumns->nameCapacity : 1024;
+         while (capacity < nameBytes) capacity *= 2;
+         char *pNames = (char*)realloc(pColumns->nameData, capacity);
+         if (pNames == NULL) return 0;
+         pColumns->nameData = pNames;
+         pColumns->nameCapacity = capacity;
+     }
+     return 1;
+ }
+ 
+ /**
+  * @brief Copy rows from a node to the end of the chain
+  * @param pColumns Pointer to the snapshot
+  * @param pFirst First node to copy
+  * @param rows Number of nodes from pFirst to the tail
+  * @return 1 on success, 0 if out of memory
+  */
+ static int appendRows(StudentColumns *pColumns, const Node *pFirst, size_t rows) {
+     size_t row = pColumns->count;
+     if (!reserveColumns(pColumns, row + rows, pColumns->nameSize + rows * sizeof(pFirst->dataStudent.nameStudent))) {
+         return 0;
+     }
+     for (const Node *current = pFirst; current != NULL; current = current->pNextNode, row++) {
+         const Student *pStudent = &current->dataStudent;
+         const char *pEnd = (const char*)memchr(pStudent->nameStudent, '\0', sizeof(pStudent->nameStudent) - 1);
+         size_t length = (pEnd != NULL) ? (size_t)(pEnd - pStudent->nameStudent) : sizeof(pStudent->nameStudent) - 1;
+         pColumns->gpa[row] = pStudent->GPA;
+         pColumns->age[row] = pStudent->ageStudent;
+         pColumns->nameOffset[row] = (uint32_t)pColumns->nameSize;
+         memcpy(pColumns->nameData + pColumns->nameSize, pStudent->nameStudent, length);
+         pColumns->nameData[pColumns->nameSize + length] = '\0';
+         pColumns->nameSize += length + 1;
+         pColumns->pLastNode = current;
+     }
+     pColumns->count = row;
+     return 1;
+ }
+ 
+ /**
+  * @brief Initialize an empty snapshot
+  * @param pColumns Pointer to the snapshot
+  */
+ void initStudentColumns(StudentColumns *pColumns) {
+     memset(pColumns, 0, sizeof(StudentColumns));
+ }
+ 
+ /**
+  * @brief Bring the snapshot up to date with a list
+  * @param pColumns Pointer to the snapshot
+  * @param pList List to materialize
+  * @return 1 on success, 0 if out of memory (the snapshot is then empty)
+  */
+ int refreshStudentColumns(StudentColumns *pColumns, const LinkedList *pList) {
+     int sameShape = (pColumns->pSource == pList && pColumns->reshapeCount == pList->reshapeCount);
+     int ok;
+ 
+     if (sameShape && pColumns->changeCount == pList->changeCount) {
+         return 1; /* Nothing changed */
+     }
+     if (sameShape && pColumns->count <= (size_t)pList->nodeCount) {
+         /* Only appends since the last refresh: copy the new tail rows */
+         const Node *pFirst = (pColumns->pLastNode != NULL) ? pColumns->pLastNode->pNextNode : pList->pHead;
+         ok = appendRows(pColumns, pFirst, (size_t)pList->nodeCount - pColumns->count);
+     } else {
+         pColumns->count = 0;
+         pColumns->nameSize = 0;
+         pColumns->pLastNode = NULL;
+         ok = appendRows(pColumns, pList->pHead, (size_t)pList->nodeCount);
+     }
+     if (!ok) {
+         pColumns->count = 0;
+         pColumns->nameSize = 0;
+         pColumns->pLastNode = NULL;
+         pColumns->pSource = NULL; /* Force a full rebuild next time */
+         return 0;
+     }
+     pColumns->pSource = pList;
+     pColumns->changeCount = pList->changeCount;
+     pColumns->reshapeCount = pList->reshapeCount;
+     return 1;
+ }
+ 
+ /**
+  * @brief Free the snapshot arrays
+  * @param pColumns Pointer to the snapshot
+  */
+ void freeStudentColumns(StudentColumns *pColumns) {
+     free(pColumns->gpa);
+     free(pColumns->age);
+     free(pColumns->nameOffset);
+     free(pColumns->nameData);
+     initStudentColumns(pColumns);
+ }
+ 
+ /**
+  * @brief Get the name of a row
+  * @param pColumns Pointer to the snapshot
+  * @param row Row index
+  * @return Null-terminated name
+  */
+ const char* columnsName(const StudentColumns *pColumns, size_t row) {
+     return pColumns->nameData + pColumns->nameOffset[row];
+ }
+ 
+ /**
+  * @brief Compute all GPA/age aggregates in one vectorized pass
+  * @param pColumns Pointer to the snapshot
+  * @param pResult Receives the aggregates
+  */
+ void columnsAggregate(const StudentColumns *pColumns, StudentAggregates *pResult) {
+     aggregateColumns(pColumns->gpa, pColumns->age, pColumns->count, pResult);
+ }
+ 
+ /**
+  * @brief Count rows in each GPA band of the report
+  * @param pColumns Pointer to the snapshot
+  * @param pDistribution Receives the counts
+  */
+ void columnsGpaDistribution(const StudentColumns *pColumns, GpaDistribution *pDistribution) {
+     StudentAggregates result;
+     columnsAggregate(pColumns, &result);
+     pDistribution->excellent = result.excellent;
+     pDistribution->good = result.good;
+     pDistribution->average = result.average;
+     pDistribution->weak = result.weak;
+ }
+ 
+ /**
+  * @brief Compute min, max and mean of GPA and age
+  * @param pColumns Pointer to the snapshot
+  * @param pStats Receives the statistics (all zero for an empty snapshot)
+  */
+ void columnsStats(const StudentColumns *pColumns, ColumnStats *pStats) {
+     StudentAggregates result;
+     memset(pStats, 0, sizeof(ColumnStats));
+     if (pColumns->count == 0) return;
+     columnsAggregate(pColumns, &result);
+     pStats->minGpa = result.gpaMin;
+     pStats->maxGpa = result.gpaMax;
+     pStats->meanGpa = result.gpaSum / (double)result.count;
+     pStats->minAge = result.ageMin;
+     pStats->maxAge = result.ageMax;
+     pStats->meanAge = (double)result.ageSum / (double)result.count;
+ }
+ 
+ /**
+  * @brief Histogram of ages, one bin per year starting at minAge
+  * @param pColumns Pointer to the snapshot
+  * @param minAge Age counted in bins[0]
+  * @param bins Bin array, cleared first
+  * @param nbins Number of bins; ages outside the range are not counted
+  */
+ void columnsAgeHistogram(const StudentColumns *pColumns, int minAge, int *bins, int nbins) {
+     memset(bins, 0, (size_t)nbins * sizeof(int));
+     for (size_t i = 0; i < pColumns->count; i++) {
+         unsigned int bin = (unsigned int)(pColumns->age[i] - minAge); /* Below minAge wraps high */
+         if (bin < (unsigned int)nbins) bins[bin]++;
+     }
+ }
@@ -0,0 +1,136 @@
+/**
+ ******************************************************************************
+ * @file    studentcolumns.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for the columnar (struct-of-arrays) student snapshot
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef STUDENTCOLUMNS_H
+ #define STUDENTCOLUMNS_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include <stdint.h>
+ #include "linkedlist.h"
+ #include "ColumnKernels.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Contiguous copy of the list, one array per field
+  */
+ typedef struct StudentColumns {
+     float *gpa;                 /* GPA of each row */
+     int *age;                   /* Age of each row */
+     uint32_t *nameOffset;       /* Offset of each row's name in nameData */
+     char *nameData;             /* Packed null-terminated names */
+     size_t count;               /* Number of rows */
+     size_t capacity;            /* Rows allocated in gpa, age and nameOffset */
+     size_t nameSize;            /* Bytes used in nameData */
+     size_t nameCapacity;        /* Bytes allocated in nameData */
+     const LinkedList *pSource;  /* List the snapshot was taken from */
+     const Node *pLastNode;      /* Node of the last row, to resume after appends */
+     unsigned long changeCount;  /* Source changeCount when last refreshed */
+     unsigned long reshapeCount; /* Source reshapeCount when last refreshed */
+ } StudentColumns;
+ 
+ /**
+  * @brief GPA distribution using the report thresholds
+  */
+ typedef struct GpaDistribution {
+     int excellent;         /* GPA >= 3.5 */
+     int good;              /* 3.0 <= GPA < 3.5 */
+     int average;           /* 2.0 <= GPA < 3.0 */
+     int weak;              /* GPA < 2.0 */
+ } GpaDistribution;
+ 
+ /**
+  * @brief Summary statistics of the GPA and age columns
+  */
+ typedef struct ColumnStats {
+     float minGpa;          /* Lowest GPA */
+     float maxGpa;          /* Highest GPA */
+     double meanGpa;        /* Average GPA */
+     int minAge;            /* Lowest age */
+     int maxAge;            /* Highest age */
+     double meanAge;        /* Average age */
+ } ColumnStats;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Initialize an empty snapshot
+  * @param pColumns Pointer to the snapshot
+  */
+ void initStudentColumns(StudentColumns *pColumns);
+ 
+ /**
+  * @brief Bring the snapshot up to date with a list
+  * @param pColumns Pointer to the snapshot
+  * @param pList List to materialize
+  * @return 1 on success, 0 if out of memory (the snapshot is then empty)
+  * @note  Does nothing if the list is unchanged, only copies the new rows if
+  *        the list was only appended to, and rebuilds in one pass otherwise
+  */
+ int refreshStudentColumns(StudentColumns *pColumns, const LinkedList *pList);
+ 
+ /**
+  * @brief Free the snapshot arrays
+  * @param pColumns Pointer to the snapshot
+  */
+ void freeStudentColumns(StudentColumns *pColumns);
+ 
+ /**
+  * @brief Get the name of a row
+  * @param pColumns Pointer to the snapshot
+  * @param row Row index
+  * @return Null-terminated name
+  */
+ const char* columnsName(const StudentColumns *pColumns, size_t row);
+ 
+ /**
+  * @brief Compute all GPA/age aggregates in one vectorized pass
+  * @param pColumns Pointer to the snapshot
+  * @param pResult Receives the aggregates
+  */
+ void columnsAggregate(const StudentColumns *pColumns, StudentAggregates *pResult);
+ 
+ /**
+  * @brief Count rows in each GPA band of the report
+  * @param pColumns Pointer to the snapshot
+  * @param pDistribution Receives the counts
+  */
+ void columnsGpaDistribution(const StudentColumns *pColumns, GpaDistribution *pDistribution);
+ 
+ /**
+  * @brief Compute min, max and mean of GPA and age
+  * @param pColumns Pointer to the snapshot
+  * @param pStats Receives the statistics (all zero for an empty snapshot)
+  */
+ void columnsStats(const StudentColumns *pColumns, ColumnStats *pStats);
+ 
+ /**
+  * @brief Histogram of ages, one bin per year starting at minAge
+  * @param pColumns Pointer to the snapshot
+  * @param minAge Age counted in bins[0]
+  * @param bins Bin array, cleared first
+  * @param nbins Number of bins; ages outside the range are not counted
+  */
+ void columnsAgeHistogram(const StudentColumns *pColumns, int minAge, int *bins, int nbins);
+ 
+ #endif /* STUDENTCOLUMNS_H */
@@ -0,0 +1,471 @@
+/**
+ ******************************************************************************
+ * @file    studentimport.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of the streaming CSV/TSV student importer
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include <limits.h>
+ #include "StudentImport.h"
+
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define IMPORT_CHUNK_SIZE                   (1U << 20) /* Bytes per read; also the longest line */
+ #define IMPORT_BATCH_ROWS                   (1024U)    /* Rows appended per node block */
+ #define IMPORT_FIELD_SIZE                   (64U)      /* Longest field kept; longer ones are rejected */
+ #define IMPORT_REJECT_ECHO                  (200)      /* Bytes of an overlong line echoed to the reject file */
+ #define IMPORT_FAST_DIGITS                  (15)       /* Decimal digits parsed exactly without strtod */
+ 
+ #define IS_ALPHA(c)                         (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z'))
+ #define IS_DIGIT(c)                         ((c) >= '0' && (c) <= '9')
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Parsed row waiting in the current batch
+  */
+ typedef struct ImportRow {
+     Student student;               /* Parsed student, valid if error is IMPORT_ROW_OK */
+     const char *pRaw;              /* Row text inside the read buffer */
+     size_t rawLength;              /* Row length */
+     unsigned long line;            /* Line number, 1-based */
+     ImportError_TypeDef error;     /* Validation result */
+ } ImportRow;
+ 
+ /**
+  * @brief State of one import run
+  */
+ typedef struct ImportState {
+     LinkedList *pList;             /* Destination list */
+     FILE *pRejects;                /* Reject file, NULL if not wanted */
+     ImportOptions options;         /* Options with the delimiter resolved */
+     ImportResult result;           /* Counters */
+     ImportRow *pBatch;             /* Rows parsed since the last flush */
+     size_t batchCount;             /* Rows in pBatch */
+ } ImportState;
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Fill import options with the defaults (detect delimiter and header, reject duplicates)
+  * @param pOptions Pointer to the options
+  */
+ void initImportOptions(ImportOptions *pOptions) {
+     pOptions->delimiter = 0;
+     pOptions->skipHeader = -1;
+     pOptions->rejectDuplicates = 1;
+ }
+ 
+ /**
+  * @brief Check a name against the interactive name rules
+  * @param name Name characters, not necessarily terminated
+  * @param length Number of characters
+  * @return IMPORT_ROW_OK, IMPORT_ERROR_INVALID_NAME or IMPORT_ERROR_NAME_TOO_LONG
+  */
+ ImportError_TypeDef validateStudentName(const char *name, size_t length) {
+     if (length > MAX_NAME_LENGTH) return IMPORT_ERROR_NAME_TOO_LONG;
+     if (length < MIN_NAME_LENGTH) return IMPORT_ERROR_INVALID_NAME;
+     for (size_t i = 0; i < length; i++) {
+         if (name[i] == ' ') {
+             if (i == 0 || name[i - 1] == ' ') return IMPORT_ERROR_INVALID_NAME; /* Leading or repeated space */
+         } else if (!IS_ALPHA(name[i])) {
+             return IMPORT_ERROR_INVALID_NAME;
+         }
+     }
+     return IMPORT_ROW_OK;
+ }
+ 
+ /**
+  * @brief Check that a GPA is inside the accepted scale
+  * @param gpa GPA as stored in Student
+  * @return 1 if valid, 0 otherwise
+  */
+ int isValidGpa(float gpa) {
+     return !(gpa > MAX_GPA_SCALE || gpa < MIN_GPA_SCALE);
+ }
+ 
+ /**
+  * @brief Get a short label for an import error code
+  * @param error Error code
+  * @return Constant label such as "INVALID_NAME"
+  */
+ const char* importErrorName(ImportError_TypeDef error) {
+     switch (error) {
+         case IMPORT_ROW_OK:               return "OK";
+         case IMPORT_ERROR_FIELD_COUNT:    return "FIELD_COUNT";
+         case IMPORT_ERROR_INVALID_NAME:   return "INVALID_NAME";
+         case IMPORT_ERROR_NAME_TOO_LONG:  return "NAME_TOO_LONG";
+         case IMPORT_ERROR_INVALID_AGE:    return "INVALID_AGE";
+         case IMPORT_ERROR_INVALID_GPA:    return "INVALID_GPA";
+         case IMPORT_ERROR_GPA_RANGE:      return "GPA_RANGE";
+         case IMPORT_ERROR_DUPLICATE_NAME: return "DUPLICATE_NAME";
+         case IMPORT_ERROR_LINE_TOO_LONG:  return "LINE_TOO_LONG";
+         default:                          return "UNKNOWN";
+     }
+ }
+ 
+ /**
+  * @brief Cut the next field off a row, handling double-quoted fields
+  * @param ppCursor In: start of the field, out: start of the next field
+  * @param pEnd End of the row
+  * @param delimiter Field separator
+  * @param pOut Buffer of IMPORT_FIELD_SIZE bytes receiving the terminated field
+  * @param pLength Receives the field length (may exceed the buffer, which then holds a prefix)
+  * @param pMore Receives 1 if a delimiter followed the field
+  * @return 1 on success, 0 on a malformed quoted field
+  */
+ static int nextField(const char **ppCursor, const char *pEnd, char delimiter,
+                      char *pOut, size_t *pLength, int *pMore) {
+     const char *p = *ppCursor;
+     size_t length = 0;
+     if (p < pEnd && *p == '"') {
+         int closed = 0;
+         for (p++; p < pEnd; p++) {
+             if (*p == '"') {
+                 if (p + 1 < pEnd && p[1] == '"') {
+                     p++; /* "" is an escaped quote */
+                 } else {
+                     closed = 1;
+                     p++;
+                     break;
+                 }
+             }
+             if (length < IMPORT_FIELD_SIZE - 1) pOut[length] = *p;
+             length++;
+         }
+         while (p < pEnd && *p == ' ') p++;
+         if (!closed || (p < pEnd && *p != delimiter)) return 0;
+     } else {
+         const char *pStop = (const char*)memchr(p, delimiter, (size_t)(pEnd - p));
+         if (pStop == NULL) pStop = pEnd;
+         length = (size_t)(pStop - p);
+         memcpy(pOut, p, (length < IMPORT_FIELD_SIZE - 1) ? length : IMPORT_FIELD_SIZE - 1);
+         p = pStop;
+     }
+     pOut[(length < IMPORT_FIELD_SIZE - 1) ? length : IMPORT_FIELD_SIZE - 1] = '\0';
+     *pLength = length;
+     *pMore = (p < pEnd);
+     *ppCursor = *pMore ? p + 1 : p;
+     return 1;
+ }
+ 
+ /**
+  * @brief Strip surrounding spaces from a terminated field
+  * @param pField Field buffer
+  * @return Start of the trimmed field
+  */
+ static char* trimField(char *pField) {
+     size_t length;
+     while (*pField == ' ') pField++;
+     length = strlen(pField);
+     while (length > 0 && pField[length - 1] == ' ') pField[--length] = '\0';
+     return pField;
+ }
+ 
+ /**
+  * @brief Parse an age: a non-negative integer, like getInputNumber
+  * @param pText Terminated field
+  * @param pAge Receives the age
+  * @return 1 on success, 0 if invalid
+  */
+ static int parseAge(const char *pText, int *pAge) {
+     long value = 0;
+     if (*pText == '\0') return 0;
+     for (; *pText != '\0'; pText++) {
+         if (!IS_DIGIT(*pText)) return 0;
+         value = value * 10 + (*pText - '0');
+         if (value > INT_MAX) return 0;
+     }
+     *pAge = (int)value;
+     return 1;
+ }
+ 
+ /**
+  * @brief Parse a GPA with the number format accepted by getDoubleNumber
+  * @param pText Terminated field
+  * @param pValue Receives the value
+  * @return 1 on success, 0 if the text is not a real number
+  * @note  Plain decimals with up to 15 digits are converted exactly as
+  *        mantissa / 10^k (both exact doubles, so the division rounds once);
+  *        anything else goes through strtod
+  */
+ static int parseGpa(const char *pText, double *pValue) {
+     static const double powersOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+                                           1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15 };
+     const char *p = pText;
+     int digits = 0, fractionDigits = 0, decimalFound = 0, exponentFound = 0;
+     int negative = (*p == '-');
+     unsigned long long mantissa = 0;
+ 
+     if (*p == '+' || *p == '-') p++;
+     for (; *p != '\0'; p++) {
+         if (IS_DIGIT(*p)) {
+             if (!exponentFound) {
+                 if (digits < IMPORT_FAST_DIGITS) mantissa = mantissa * 10 + (unsigned long long)(*p - '0');
+                 digits++;
+                 if (decimalFound) fractionDigits++;
+             }
+         } else if (*p == '.') {
+             if (decimalFound || exponentFound) return 0;
+             decimalFound = 1;
+         } else if ((*p == 'e' || *p == 'E') && digits > 0 && !exponentFound) {
+             exponentFound = 1;
+             if (p[1] == '+' || p[1] == '-') p++;
+             if (!IS_DIGIT(p[1])) return 0;
+         } else {
+             return 0;
+         }
+     }
+     if (digits == 0) return 0;
+     if (!exponentFound && digits <= IMPORT_FAST_DIGITS) {
+         double value = (double)mantissa / powersOfTen[fractionDigits];
+         *pValue = negative ? -value : value;
+         return 1;
+     }
+     *pValue = strtod(pText, NULL);
+     return 1;
+ }
+ 
+ /**
+  * @brief Parse and validate one row into a batch entry
+  * @param pState Import state
+  * @param pRow Row to fill (pRaw and rawLength already set)
+  */
+ static void parseRow(const ImportState *pState, ImportRow *pRow) {
+     char nameField[IMPORT_FIELD_SIZE], ageField[IMPORT_FIELD_SIZE], gpaField[IMPORT_FIELD_SIZE];
+     size_t nameLength, ageLength, gpaLength;
+     const char *p = pRow->pRaw;
+     const char *pEnd = pRow->pRaw + pRow->rawLength;
+     char delimiter = pState->options.delimiter;
+     int more = 0;
+     double gpa;
+ 
+     if (!nextField(&p, pEnd, delimiter, nameField, &nameLength, &more) || !more
+         || !nextField(&p, pEnd, delimiter, ageField, &ageLength, &more) || !more
+         || !nextField(&p, pEnd, delimiter, gpaField, &gpaLength, &more) || more) {
+         pRow->error = IMPORT_ERROR_FIELD_COUNT;
+         return;
+     }
+     pRow->error = validateStudentName(nameField, nameLength);
+     if (pRow->error != IMPORT_ROW_OK) return;
+     if (ageLength >= IMPORT_FIELD_SIZE || !parseAge(trimField(ageField), &pRow->student.ageStudent)) {
+         pRow->error = IMPORT_ERROR_INVALID_AGE;
+         return;
+     }
+     if (gpaLength >= IMPORT_FIELD_SIZE || !parseGpa(trimField(gpaField), &gpa)) {
+         pRow->error = IMPORT_ERROR_INVALID_GPA;
+         return;
+     }
+     pRow->student.GPA = (float)gpa;
+     if (!isValidGpa(pRow->student.GPA)) {
+         pRow->error = IMPORT_ERROR_GPA_RANGE;
+         return;
+     }
+     memcpy(pRow->student.nameStudent, nameField, nameLength + 1);
+ }
+ 
+ /**
+  * @brief Write a rejected row to the reject file
+  * @param pState Import state
+  * @param line Line number
+  * @param error Reason
+  * @param pRaw Row text
+  * @param length Row length
+  */
+ static void rejectRow(ImportState *pState, unsigned long line, ImportError_TypeDef error,
+                       const char *pRaw, size_t length) {
+     pState->result.rejected++;
+     if (pState->pRejects != NULL) {
+         fprintf(pState->pRejects, "%lu\t%d\t%s\t%.*s\n", line, (int)error, importErrorName(error), (int)length, pRaw);
+     }
+ }
+ 
+ /**
+  * @brief Append the accepted rows of the batch and report the rejected ones, in line order
+  * @param pState Import state
+  * @return 1 on success, 0 if out of memory
+  */
+ static int flushBatch(ImportState *pState) {
+     size_t accepted = 0, used = 0;
+     Node *pBlock = NULL;
+     for (size_t i = 0; i < pState->batchCount; i++) {
+         if (pState->pBatch[i].error == IMPORT_ROW_OK) accepted++;
+     }
+     if (accepted != 0) {
+         pBlock = poolAllocBlock(getDefaultNodePool(), accepted);
+         if (pBlock == NULL) return 0;
+     }
+     for (size_t i = 0; i < pState->batchCount; i++) {
+         ImportRow *pRow = &pState->pBatch[i];
+         if (pRow->error == IMPORT_ROW_OK && pState->options.rejectDuplicates
+             && findStudentByName(pState->pList, pRow->student.nameStudent) != NULL) {
+             pRow->error = IMPORT_ERROR_DUPLICATE_NAME; /* Also catches repeats earlier in this batch */
+         }
+         if (pRow->error == IMPORT_ROW_OK) {
+             Node *pNode = &pBlock[used++];
+             pNode->dataStudent = pRow->student;
+             addTail(pState->pList, pNode);
+             pState->result.imported++;
+         } else {
+             rejectRow(pState, pRow->line, pRow->error, pRow->pRaw, pRow->rawLength);
+         }
+     }
+     for (; used < accepted; used++) {
+         poolFreeNode(getDefaultNodePool(), &pBlock[used]); /* Nodes of duplicate rows */
+     }
+     pState->batchCount = 0;
+     return 1;
+ }
+ 
+ /**
+  * @brief Handle one line of the file
+  * @param pState Import state
+  * @param pLine Line text without the newline
+  * @param length Line length
+  * @return 1 on success, 0 if out of memory
+  */
+ static int processLine(ImportState *pState, const char *pLine, size_t length) {
+     unsigned long line = ++pState->result.lines;
+     ImportRow *pRow;
+     if (length > 0 && pLine[length - 1] == '\r') length--;
+     if (length == 0) return 1; /* Blank line */
+     if (pState->options.delimiter == 0) {
+         pState->options.delimiter = (memchr(pLine, '\t', length) != NULL) ? '\t' : ',';
+     }
+     pRow = &pState->pBatch[pState->batchCount];
+     pRow->pRaw = pLine;
+     pRow->rawLength = length;
+     pRow->line = line;
+     parseRow(pState, pRow);
+     if (line == 1 && (pState->options.skipHeader == 1
+                       || (pState->options.skipHeader == -1 && pRow->error == IMPORT_ERROR_INVALID_AGE))) {
+         return 1; /* Header row */
+     }
+     if (++pState->batchCount == IMPORT_BATCH_ROWS) {
+         return flushBatch(pState);
+     }
+     return 1;
+ }
+ 
+ /**
+  * @brief Append the students of a CSV or TSV file (name, age, GPA per line) to the list
+  * @param pList Pointer to the linked list
+  * @param filename Name of the file to import
+  * @param rejectFilename File receiving rejected rows, NULL to only count them
+  * @param pOptions Import options, NULL for the defaults
+  * @param pResult Receives the counters, may be NULL
+  * @return 1 if the whole file was processed, 0 on an I/O or memory error (a message is printed)
+  */
+ int importStudentsCsv(LinkedList *pList, const char *filename, const char *rejectFilename,
+                       const ImportOptions *pOptions, ImportResult *pResult) {
+     ImportState state;
+     char *pBuffer;
+     size_t filled = 0;
+     int skipping = 0, atEnd = 0, ok = 1, ownIndex = 0;
+     FILE *file;
+ 
+     memset(&state, 0, sizeof(state));
+     state.pList = pList;
+     if (pOptions != NULL) state.options = *pOptions;
+     else initImportOptions(&state.options);
+ 
+     file = fopen(filename, "rb");
+     if (file == NULL) {
+         printf("Error opening file for reading.\n");
+         return 0;
+     }
+     if (rejectFilename != NULL) {
+         state.pRejects = fopen(rejectFilename, "w");
+         if (state.pRejects == NULL) {
+             printf("Error opening file for writing.\n");
+             fclose(file);
+             return 0;
+         }
+     }
+     pBuffer = (char*)malloc(IMPORT_CHUNK_SIZE);
+     state.pBatch = (ImportRow*)malloc(IMPORT_BATCH_ROWS * sizeof(ImportRow));
+     if (pBuffer == NULL || state.pBatch == NULL) {
+         printf("Memory allocation failed!\n");
+         ok = 0;
+     }
+ 
+     if (ok && state.options.rejectDuplicates && pList->pNameIndex == NULL) {
+         ownIndex = enableNameIndex(pList); /* Duplicate checks would scan the list per row */
+     }
+ 
+     while (ok && !atEnd) {
+         size_t start = 0, got = fread(pBuffer + filled, 1, IMPORT_CHUNK_SIZE - filled, file);
+         const char *pNewline;
+         if (got == 0) {
+             if (ferror(file)) {
+                 printf("Error reading file!\n");
+                 ok = 0;
+                 break;
+             }
+             atEnd = 1;
+         }
+         filled += got;
+ 
+         if (skipping) {
+             /* Drop the rest of an overlong line */
+             pNewline = (const char*)memchr(pBuffer, '\n', filled);
+             if (pNewline == NULL) {
+                 filled = 0;
+                 continue;
+             }
+             start = (size_t)(pNewline - pBuffer) + 1;
+             skipping = 0;
+         }
+         while (ok && (pNewline = (const char*)memchr(pBuffer + start, '\n', filled - start)) != NULL) {
+             ok = processLine(&state, pBuffer + start, (size_t)(pNewline - (pBuffer + start)));
+             start = (size_t)(pNewline - pBuffer) + 1;
+         }
+         if (ok && atEnd && start < filled) {
+             ok = processLine(&state, pBuffer + start, filled - start); /* Last line without a newline */
+             start = filled;
+         }
+         if (ok) ok = flushBatch(&state); /* Rows point into the buffer: flush before reusing it */
+         if (!ok) {
+             printf("Memory allocation failed!\n");
+             break;
+         }
+ 
+         if (start == 0 && filled == IMPORT_CHUNK_SIZE) {
+             rejectRow(&state, ++state.result.lines, IMPORT_ERROR_LINE_TOO_LONG, pBuffer, IMPORT_REJECT_ECHO);
+             skipping = 1;
+             filled = 0;
+         } else {
+             memmove(pBuffer, pBuffer + start, filled - start); /* Keep the partial line */
+             filled -= start;
+         }
+     }
+ 
+     if (ownIndex) disableNameIndex(pList);
+     free(pBuffer);
+     free(state.pBatch);
+     fclose(file);
+     if (state.pRejects != NULL && fclose(state.pRejects) != 0) {
+         printf("Error writing to file!\n");
+         ok = 0;
+     }
+     if (pResult != NULL) *pResult = state.result;
+     return ok;
+ }
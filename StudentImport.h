@@ -0,0 +1,133 @@
+/**
+ ******************************************************************************
+ * @file    studentimport.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for the streaming CSV/TSV student importer
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef STUDENTIMPORT_H
+ #define STUDENTIMPORT_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include "linkedlist.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ /** @defgroup Length of name
+  * @{
+  */
+ #define MIN_NAME_LENGTH                     (2U)
+ #define MAX_NAME_LENGTH                     (49U) /* nameStudent minus the terminator */
+ /**
+  * @}
+  */
+ 
+ /** @defgroup Score range
+  * @{
+  */
+ #define MAX_GPA_SCALE                       ((double)10U)
+ #define MIN_GPA_SCALE                       (0)
+ /**
+  * @}
+  */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Reason a row was rejected, written to the reject file
+  */
+ typedef enum {
+     IMPORT_ROW_OK,                  /* Row accepted */
+     IMPORT_ERROR_FIELD_COUNT,       /* Not exactly name, age and GPA */
+     IMPORT_ERROR_INVALID_NAME,      /* Name breaks the input rules */
+     IMPORT_ERROR_NAME_TOO_LONG,     /* Name longer than MAX_NAME_LENGTH */
+     IMPORT_ERROR_INVALID_AGE,       /* Age is not a non-negative integer */
+     IMPORT_ERROR_INVALID_GPA,       /* GPA is not a real number */
+     IMPORT_ERROR_GPA_RANGE,         /* GPA outside [MIN_GPA_SCALE, MAX_GPA_SCALE] */
+     IMPORT_ERROR_DUPLICATE_NAME,    /* Name already in the list */
+     IMPORT_ERROR_LINE_TOO_LONG      /* Line does not fit the read buffer */
+ } ImportError_TypeDef;
+ 
+ /**
+  * @brief Import settings
+  */
+ typedef struct ImportOptions {
+     char delimiter;        /* ',' or '\t'; 0 picks '\t' if the first line has one, else ',' */
+     int skipHeader;        /* 1 to skip the first line, 0 to import it, -1 to skip it if its age is not a number */
+     int rejectDuplicates;  /* 1 to reject names already in the list, like interactive input */
+ } ImportOptions;
+ 
+ /**
+  * @brief Import counters
+  */
+ typedef struct ImportResult {
+     unsigned long lines;       /* Lines read, including header and blank lines */
+     unsigned long imported;    /* Students appended to the list */
+     unsigned long rejected;    /* Rows written to the reject file */
+ } ImportResult;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Fill import options with the defaults (detect delimiter and header, reject duplicates)
+  * @param pOptions Pointer to the options
+  */
+ void initImportOptions(ImportOptions *pOptions);
+ 
+ /**
+  * @brief Check a name against the interactive name rules
+  * @param name Name characters, not necessarily terminated
+  * @param length Number of characters
+  * @return IMPORT_ROW_OK, IMPORT_ERROR_INVALID_NAME or IMPORT_ERROR_NAME_TOO_LONG
+  * @note  Letters and single inner spaces only, no leading space, at least
+  *        MIN_NAME_LENGTH characters. main.c checks typed names with it too
+  */
+ ImportError_TypeDef validateStudentName(const char *name, size_t length);
+ 
+ /**
+  * @brief Check that a GPA is inside the accepted scale
+  * @param gpa GPA as stored in Student
+  * @return 1 if valid, 0 otherwise
+  */
+ int isValidGpa(float gpa);
+ 
+ /**
+  * @brief Get a short label for an import error code
+  * @param error Error code
+  * @return Constant label such as "INVALID_NAME"
+  */
+ const char* importErrorName(ImportError_TypeDef error);
+ 
+ /**
+  * @brief Append the students of a CSV or TSV file (name, age, GPA per line) to the list
+  * @param pList Pointer to the linked list
+  * @param filename Name of the file to import
+  * @param rejectFilename File receiving rejected rows as "line<TAB>code<TAB>label<TAB>row", NULL to only count them
+  * @param pOptions Import options, NULL for the defaults
+  * @param pResult Receives the counters, may be NULL
+  * @return 1 if the whole file was processed, 0 on an I/O or memory error (a message is printed)
+  * @note  The file is read in large chunks and accepted rows are appended in
+  *        batches whose nodes come from one pool block. If duplicates are
+  *        rejected and the list has no name index, one is kept for the run.
+  */
+ int importStudentsCsv(LinkedList *pList, const char *filename, const char *rejectFilename,
+                       const ImportOptions *pOptions, ImportResult *pResult);
+ 
+ #endif /* STUDENTIMPORT_H */
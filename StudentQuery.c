@@ -0,0 +1,379 @@
+/**
+ ******************************************************************************
+ * @file    studentquery.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of top-K and range queries on GPA and age
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include <math.h>
+ #include "StudentQuery.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Candidate of a top-K heap
+  */
+ typedef struct TopEntry {
+     float gpa;             /* GPA of the student */
+     size_t position;       /* Position in the list (0-based) */
+     const Node *pNode;     /* Node of the student */
+ } TopEntry;
+ 
+ /**
+  * @brief Student with its key and list position, one row of a scanned range
+  */
+ typedef struct RangeEntry {
+     double key;            /* Age or GPA, widened so one type serves both */
+     size_t position;       /* Position in the list (0-based), breaks ties in list order */
+     const Node *pNode;     /* Node of the student */
+ } RangeEntry;
+ 
+ /**
+  * @brief Field a range query compares
+  */
+ typedef enum {
+     RANGE_BY_AGE,                  /* ageStudent */
+     RANGE_BY_GPA                   /* GPA */
+ } RangeField_TypeDef;
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Pack a node's age and order label, in range index order
+  * @param pNode Node
+  * @return Age with the sign bit flipped, then the label
+  */
+ static uint64_t packAge(const Node *pNode) {
+     uint32_t age = (uint32_t)pNode->dataStudent.ageStudent ^ 0x80000000U; /* Negative ages first */
+     return ((uint64_t)age << 32) | pNode->orderLabel;
+ }
+ 
+ /**
+  * @brief Pack a node's GPA and order label, in range index order
+  * @param pNode Node
+  * @return GPA bits mapped to unsigned order, NaN last, then the label
+  */
+ static uint64_t packGpa(const Node *pNode) {
+     float gpa = pNode->dataStudent.GPA;
+     uint32_t bits;
+     if (isnan(gpa)) {
+         bits = UINT32_MAX; /* After every number, where range queries never reach */
+     } else {
+         if (gpa == 0.0f) gpa = 0.0f; /* -0 and +0 are the same GPA */
+         memcpy(&bits, &gpa, sizeof(bits));
+         bits = (bits & 0x80000000U) ? ~bits : (bits | 0x80000000U);
+     }
+     return ((uint64_t)bits << 32) | pNode->orderLabel;
+ }
+ 
+ /**
+  * @brief Order two nodes by age, then list position
+  * @param pA First node
+  * @param pB Second node
+  * @return Negative, zero or positive as for strcmp
+  */
+ static int compareByAge(const Node *pA, const Node *pB) {
+     uint64_t a = packAge(pA);
+     uint64_t b = packAge(pB);
+     return (a > b) - (a < b);
+ }
+ 
+ /**
+  * @brief Order two nodes by GPA, then list position
+  * @param pA First node
+  * @param pB Second node
+  * @return Negative, zero or positive as for strcmp
+  */
+ static int compareByGpa(const Node *pA, const Node *pB) {
+     uint64_t a = packGpa(pA);
+     uint64_t b = packGpa(pB);
+     return (a > b) - (a < b);
+ }
+ 
+ /**
+  * @brief Check whether a node's age is below a bound
+  * @param pNode Node
+  * @param pKey Pointer to the bound, a double
+  * @return Non-zero if the age is below it
+  */
+ static int ageBelow(const Node *pNode, const void *pKey) {
+     return (double)pNode->dataStudent.ageStudent < *(const double*)pKey;
+ }
+ 
+ /**
+  * @brief Check whether a node's GPA is below a bound
+  * @param pNode Node
+  * @param pKey Pointer to the bound, a double
+  * @return Non-zero if the GPA is below it; never for NaN, which sorts last
+  */
+ static int gpaBelow(const Node *pNode, const void *pKey) {
+     return (double)pNode->dataStudent.GPA < *(const double*)pKey;
+ }
+ 
+ /**
+  * @brief Create an empty range index, marked dirty until built
+  * @return Pointer to the index, or NULL if out of memory
+  */
+ RangeIndex* createRangeIndex(void) {
+     RangeIndex *pIndex = (RangeIndex*)malloc(sizeof(RangeIndex));
+     if (pIndex == NULL) return NULL;
+     initSortedNodes(&pIndex->byAge, compareByAge, packAge);
+     initSortedNodes(&pIndex->byGpa, compareByGpa, packGpa);
+     return pIndex;
+ }
+ 
+ /**
+  * @brief Free the range index
+  * @param pIndex Pointer to the index (may be NULL)
+  */
+ void destroyRangeIndex(RangeIndex *pIndex) {
+     if (pIndex == NULL) return;
+     freeSortedNodes(&pIndex->byAge);
+     freeSortedNodes(&pIndex->byGpa);
+     free(pIndex);
+ }
+ 
+ /**
+  * @brief Rebuild the index from the nodes of a chain
+  * @param pIndex Pointer to the index
+  * @param pHead Head of the chain, labelled in increasing order
+  * @param count Number of nodes in the chain
+  * @return 1 on success, 0 if out of memory (the index stays dirty)
+  */
+ int rangeIndexRebuild(RangeIndex *pIndex, Node *pHead, size_t count) {
+     Node **ppNodes = NULL;
+     size_t i = 0;
+     int built;
+     if (count != 0) {
+         ppNodes = (Node**)malloc(count * sizeof(Node*));
+         if (ppNodes == NULL) {
+             pIndex->byAge.dirty = 1;
+             pIndex->byGpa.dirty = 1;
+             return 0;
+         }
+     }
+     for (Node *current = pHead; current != NULL && i < count; current = current->pNextNode) ppNodes[i++] = current; /* One walk for both */
+     built = sortedNodesRebuild(&pIndex->byAge, ppNodes, count);
+     if (built && !sortedNodesRebuild(&pIndex->byGpa, ppNodes, count)) {
+         pIndex->byAge.dirty = 1; /* Both or neither */
+         built = 0;
+     }
+     free(ppNodes);
+     return built;
+ }
+ 
+ /**
+  * @brief Add a node that was just linked
+  * @param pIndex Pointer to the index
+  * @param pNode Node, with its final data and label
+  * @return 1 on success, 0 if out of memory (the index is marked dirty)
+  */
+ int rangeIndexAdd(RangeIndex *pIndex, Node *pNode) {
+     int added = sortedNodesAdd(&pIndex->byAge, pNode);
+     return sortedNodesAdd(&pIndex->byGpa, pNode) && added;
+ }
+ 
+ /**
+  * @brief Remove a node that is being unlinked or edited
+  * @param pIndex Pointer to the index
+  * @param pNode Node, still holding the data and label it was added with
+  */
+ void rangeIndexRemove(RangeIndex *pIndex, const Node *pNode) {
+     sortedNodesRemove(&pIndex->byAge, pNode);
+     sortedNodesRemove(&pIndex->byGpa, pNode);
+ }
+ 
+ /**
+  * @brief Check whether a top-K candidate ranks below another
+  * @param pA First candidate
+  * @param pB Second candidate
+  * @return 1 if A has the lower GPA, or the same GPA and comes later in the list
+  */
+ static int ranksBelow(const TopEntry *pA, const TopEntry *pB) {
+     if (pA->gpa != pB->gpa) return pA->gpa < pB->gpa;
+     return pA->position > pB->position;
+ }
+ 
+ /**
+  * @brief Restore the heap below an entry, lowest-ranked candidate on top
+  * @param pHeap Heap array
+  * @param size Entries in the heap
+  * @param i Entry to sift down
+  */
+ static void siftDown(TopEntry *pHeap, size_t size, size_t i) {
+     TopEntry entry = pHeap[i];
+     for (;;) {
+         size_t child = 2 * i + 1;
+         if (child >= size) break;
+         if (child + 1 < size && ranksBelow(&pHeap[child + 1], &pHeap[child])) child++;
+         if (!ranksBelow(&pHeap[child], &entry)) break;
+         pHeap[i] = pHeap[child];
+         i = child;
+     }
+     pHeap[i] = entry;
+ }
+ 
+ /**
+  * @brief Copy the k students with the highest GPA, best first
+  * @param pList Pointer to the linked list
+  * @param k Number of students wanted
+  * @param pOut Receives up to k students
+  * @return Number of students copied (k or fewer), -1 if out of memory
+  */
+ int topKByGPA(LinkedList *pList, int k, Student *pOut) {
+     TopEntry *pHeap;
+     size_t limit;
+     size_t size = 0;
+     size_t position = 0;
+     if (k < 1 || pList->pHead == NULL) return 0;
+     limit = (k < pList->nodeCount) ? (size_t)k : (size_t)pList->nodeCount;
+     pHeap = (TopEntry*)malloc(limit * sizeof(TopEntry));
+     if (pHeap == NULL) {
+         printf("Memory allocation failed!\n");
+         return -1;
+     }
+     for (const Node *current = pList->pHead; current != NULL; current = current->pNextNode, position++) {
+         TopEntry entry = { current->dataStudent.GPA, position, current };
+         if (size < limit) {
+             size_t i = size++;
+             while (i > 0 && ranksBelow(&entry, &pHeap[(i - 1) / 2])) { /* Sift up */
+                 pHeap[i] = pHeap[(i - 1) / 2];
+                 i = (i - 1) / 2;
+             }
+             pHeap[i] = entry;
+         } else if (ranksBelow(&pHeap[0], &entry)) {
+             pHeap[0] = entry; /* Evict the lowest-ranked candidate */
+             siftDown(pHeap, size, 0);
+         }
+     }
+     for (size_t i = size; i > 0; i--) { /* Pop the lowest first, filling from the back */
+         pOut[i - 1] = pHeap[0].pNode->dataStudent;
+         pHeap[0] = pHeap[i - 1];
+         siftDown(pHeap, i - 1, 0);
+     }
+     free(pHeap);
+     return (int)size;
+ }
+ 
+ /**
+  * @brief Order range entries by key, then list position
+  * @param pA First entry
+  * @param pB Second entry
+  * @return Negative, zero or positive as for qsort
+  */
+ static int compareRangeEntries(const void *pA, const void *pB) {
+     const RangeEntry *a = (const RangeEntry*)pA;
+     const RangeEntry *b = (const RangeEntry*)pB;
+     if (a->key != b->key) return (a->key < b->key) ? -1 : 1;
+     return (a->position > b->position) - (a->position < b->position);
+ }
+ 
+ /**
+  * @brief Get the key of a student for a range query
+  * @param pStudent Student
+  * @param field Field compared
+  * @return Age or GPA
+  */
+ static double rangeKey(const Student *pStudent, RangeField_TypeDef field) {
+     return (field == RANGE_BY_AGE) ? (double)pStudent->ageStudent : (double)pStudent->GPA;
+ }
+ 
+ /**
+  * @brief Visit the students whose key lies in [lo, hi], by key then list order
+  * @param pList Pointer to the linked list
+  * @param field Field compared
+  * @param lo Lowest key
+  * @param hi Highest key
+  * @param pVisit Callback run on each student
+  * @param pContext Passed to the callback
+  * @return Number of students visited, -1 if out of memory
+  */
+ static int visitRange(LinkedList *pList, RangeField_TypeDef field, double lo, double hi,
+                       StudentVisit_TypeDef pVisit, void *pContext) {
+     RangeEntry *pEntries = NULL;
+     RangeIndex *pIndex = pList->pRangeIndex;
+     size_t count = 0;
+     size_t visited = 0;
+     if (!(lo <= hi)) return 0; /* Also rejects NaN bounds */
+     if (pIndex != NULL && ((!pIndex->byAge.dirty && !pIndex->byGpa.dirty)
+                            || rangeIndexRebuild(pIndex, pList->pHead, (size_t)pList->nodeCount))) {
+         const SortedNodes *pSet = (field == RANGE_BY_AGE) ? &pIndex->byAge : &pIndex->byGpa;
+         SortedCursor cursor = sortedNodesSeek(pSet, (field == RANGE_BY_AGE) ? ageBelow : gpaBelow, &lo);
+         for (const Node *pNode = sortedNodesAt(pSet, &cursor); pNode != NULL && rangeKey(&pNode->dataStudent, field) <= hi;
+              pNode = sortedNodesAt(pSet, &cursor)) {
+             pVisit(&pNode->dataStudent, pContext);
+             visited++;
+             cursor.slot++;
+         }
+         return (int)visited;
+     }
+     /* No index: collect the matches in one scan, then order them */
+     size_t capacity = 0;
+     size_t position = 0;
+     for (const Node *current = pList->pHead; current != NULL; current = current->pNextNode, position++) {
+         double key = rangeKey(&current->dataStudent, field);
+         if (!(key >= lo && key <= hi)) continue;
+         if (count == capacity) {
+             size_t newCapacity = (capacity != 0) ? capacity * 2 : 64;
+             RangeEntry *pGrown = (RangeEntry*)realloc(pEntries, newCapacity * sizeof(RangeEntry));
+             if (pGrown == NULL) {
+                 free(pEntries);
+                 printf("Memory allocation failed!\n");
+                 return -1;
+             }
+             pEntries = pGrown;
+             capacity = newCapacity;
+         }
+         pEntries[count].key = key;
+         pEntries[count].position = position;
+         pEntries[count].pNode = current;
+         count++;
+     }
+     if (count > 1) qsort(pEntries, count, sizeof(RangeEntry), compareRangeEntries);
+     for (; visited < count; visited++) pVisit(&pEntries[visited].pNode->dataStudent, pContext);
+     free(pEntries);
+     return (int)visited;
+ }
+ 
+ /**
+  * @brief Visit the students with lo <= age <= hi, by age then list order
+  * @param pList Pointer to the linked list
+  * @param lo Lowest age
+  * @param hi Highest age
+  * @param pVisit Callback run on each student; must not change the list
+  * @param pContext Passed to the callback
+  * @return Number of students visited, -1 if out of memory
+  */
+ int rangeByAge(LinkedList *pList, int lo, int hi, StudentVisit_TypeDef pVisit, void *pContext) {
+     return visitRange(pList, RANGE_BY_AGE, (double)lo, (double)hi, pVisit, pContext);
+ }
+ 
+ /**
+  * @brief Visit the students with lo <= GPA <= hi, by GPA then list order
+  * @param pList Pointer to the linked list
+  * @param lo Lowest GPA
+  * @param hi Highest GPA
+  * @param pVisit Callback run on each student; must not change the list
+  * @param pContext Passed to the callback
+  * @return Number of students visited, -1 if out of memory
+  */
+ int rangeByGPA(LinkedList *pList, float lo, float hi, StudentVisit_TypeDef pVisit, void *pContext) {
+     return visitRange(pList, RANGE_BY_GPA, (double)lo, (double)hi, pVisit, pContext);
+ }
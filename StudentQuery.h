@@ -0,0 +1,127 @@
+/**
+ ******************************************************************************
+ * @file    studentquery.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for top-K and range queries on GPA and age
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef STUDENTQUERY_H
+ #define STUDENTQUERY_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include "linkedlist.h"
+ #include "SortedNodes.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Callback run on each student of a range query
+  * @param pStudent Matching student, valid during the call only
+  * @param pContext Caller's context
+  */
+ typedef void (*StudentVisit_TypeDef)(const Student *pStudent, void *pContext);
+ 
+ /**
+  * @brief Node pointers sorted by age and by GPA
+  * @note  Kept in step by every insert, delete and edit of the list, ties
+  *        broken by the nodes' order labels so equal keys stay in list
+  *        order. Only a failed allocation leaves it dirty, and the next
+  *        query then rebuilds it.
+  */
+ typedef struct RangeIndex {
+     SortedNodes byAge;             /* Every student, by age then list order */
+     SortedNodes byGpa;             /* Every student, by GPA then list order */
+ } RangeIndex;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Create an empty range index, marked dirty until built
+  * @return Pointer to the index, or NULL if out of memory
+  */
+ RangeIndex* createRangeIndex(void);
+ 
+ /**
+  * @brief Free the range index
+  * @param pIndex Pointer to the index (may be NULL)
+  */
+ void destroyRangeIndex(RangeIndex *pIndex);
+ 
+ /**
+  * @brief Rebuild the index from the nodes of a chain
+  * @param pIndex Pointer to the index
+  * @param pHead Head of the chain, labelled in increasing order
+  * @param count Number of nodes in the chain
+  * @return 1 on success, 0 if out of memory (the index stays dirty)
+  */
+ int rangeIndexRebuild(RangeIndex *pIndex, Node *pHead, size_t count);
+ 
+ /**
+  * @brief Add a node that was just linked
+  * @param pIndex Pointer to the index
+  * @param pNode Node, with its final data and label
+  * @return 1 on success, 0 if out of memory (the index is marked dirty)
+  */
+ int rangeIndexAdd(RangeIndex *pIndex, Node *pNode);
+ 
+ /**
+  * @brief Remove a node that is being unlinked or edited
+  * @param pIndex Pointer to the index
+  * @param pNode Node, still holding the data and label it was added with
+  */
+ void rangeIndexRemove(RangeIndex *pIndex, const Node *pNode);
+ 
+ /**
+  * @brief Copy the k students with the highest GPA, best first
+  * @param pList Pointer to the linked list
+  * @param k Number of students wanted
+  * @param pOut Receives up to k students
+  * @return Number of students copied (k or fewer), -1 if out of memory
+  * @note  One pass with a bounded heap, O(n log k); the list is not
+  *        reordered. Equal GPAs keep list order, like sortByScoreDesc
+  */
+ int topKByGPA(LinkedList *pList, int k, Student *pOut);
+ 
+ /**
+  * @brief Visit the students with lo <= age <= hi, by age then list order
+  * @param pList Pointer to the linked list
+  * @param lo Lowest age
+  * @param hi Highest age
+  * @param pVisit Callback run on each student; must not change the list
+  * @param pContext Passed to the callback
+  * @return Number of students visited, -1 if out of memory
+  * @note  O(log n + m) with the range index enabled, as it is kept current
+  *        by every change; a scan of the list otherwise
+  */
+ int rangeByAge(LinkedList *pList, int lo, int hi, StudentVisit_TypeDef pVisit, void *pContext);
+ 
+ /**
+  * @brief Visit the students with lo <= GPA <= hi, by GPA then list order
+  * @param pList Pointer to the linked list
+  * @param lo Lowest GPA
+  * @param hi Highest GPA
+  * @param pVisit Callback run on each student; must not change the list
+  * @param pContext Passed to the callback
+  * @return Number of students visited, -1 if out of memory
+  * @note  O(log n + m) with the range index enabled, as it is kept current
+  *        by every change; a scan of the list otherwise
+  */
+ int rangeByGPA(LinkedList *pList, float lo, float hi, StudentVisit_TypeDef pVisit, void *pContext);
+ 
+ #endif /* STUDENTQUERY_H */
@@ -0,0 +1,558 @@
+/**
+ ******************************************************************************
+ * @file    unrolledlist.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of unrolled linked list management functions
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include "UnrolledList.h"
+
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Allocate an empty block
+  * @return Pointer to the new block
+  */
+ static StudentBlock* createBlock(void) {
+     StudentBlock *pBlock = (StudentBlock*)malloc(sizeof(StudentBlock));
+     if (pBlock == NULL) {
+         printf("Memory allocation failed!\n");
+         exit(1);
+     }
+     pBlock->pNextBlock = NULL;
+     pBlock->count = 0;
+     return pBlock;
+ }
+ 
+ /**
+  * @brief Link a new empty block after another block
+  * @param pList Pointer to the unrolled list
+  * @param pPrev Block to link after, NULL to link at the head
+  * @return The new block
+  */
+ static StudentBlock* linkNewBlock(UnrolledList *pList, StudentBlock *pPrev) {
+     StudentBlock *pBlock = createBlock();
+     if (pPrev == NULL) {
+         pBlock->pNextBlock = pList->pHead;
+         pList->pHead = pBlock;
+     } else {
+         pBlock->pNextBlock = pPrev->pNextBlock;
+         pPrev->pNextBlock = pBlock;
+     }
+     if (pBlock->pNextBlock == NULL) {
+         pList->pTail = pBlock;
+     }
+     return pBlock;
+ }
+ 
+ /**
+  * @brief Insert a student at a 0-based index, splitting a full block
+  * @param pList Pointer to the unrolled list
+  * @param index Index in [0, studentCount]
+  * @param student Student data
+  */
+ static void insertAt(UnrolledList *pList, int index, Student student) {
+     StudentBlock *pBlock;
+     int offset;
+ 
+     if (pList->pHead == NULL) {
+         linkNewBlock(pList, NULL);
+     }
+     if (index == pList->studentCount) {
+         pBlock = pList->pTail; /* Append without walking */
+         offset = pBlock->count;
+     } else {
+         pBlock = pList->pHead;
+         offset = index;
+         while (offset > pBlock->count) {
+             offset -= pBlock->count;
+             pBlock = pBlock->pNextBlock;
+         }
+     }
+     if (pBlock->count == (int)UNROLLED_BLOCK_CAPACITY) {
+         if (offset == pBlock->count) {
+             pBlock = linkNewBlock(pList, pBlock); /* Growing at the end: start a fresh block */
+             offset = 0;
+         } else if (offset == 0 && pBlock == pList->pHead) {
+             pBlock = linkNewBlock(pList, NULL); /* Growing at the front */
+         } else {
+             StudentBlock *pSplit = linkNewBlock(pList, pBlock); /* Overflow: split in half */
+             int half = (int)UNROLLED_BLOCK_CAPACITY / 2;
+             memcpy(pSplit->students, pBlock->students + half, (size_t)(pBlock->count - half) * sizeof(Student));
+             pSplit->count = pBlock->count - half;
+             pBlock->count = half;
+             if (offset > half) {
+                 pBlock = pSplit;
+                 offset -= half;
+             }
+         }
+     }
+     memmove(pBlock->students + offset + 1, pBlock->students + offset,
+             (size_t)(pBlock->count - offset) * sizeof(Student));
+     pBlock->students[offset] = student;
+     pBlock->count++;
+     pList->studentCount++;
+ }
+ 
+ /**
+  * @brief Refill or release a block that lost a student
+  * @param pList Pointer to the unrolled list
+  * @param pPrev Block before it, NULL if it is the head
+  * @param pBlock Block that shrank
+  */
+ static void rebalance(UnrolledList *pList, StudentBlock *pPrev, StudentBlock *pBlock) {
+     StudentBlock *pNext = pBlock->pNextBlock;
+     if (pBlock->count == 0) {
+         if (pPrev == NULL) pList->pHead = pNext;
+         else pPrev->pNextBlock = pNext;
+         if (pList->pTail == pBlock) pList->pTail = pPrev;
+         free(pBlock);
+         return;
+     }
+     if (pBlock->count >= (int)UNROLLED_BLOCK_MIN || pNext == NULL) return;
+     if (pBlock->count + pNext->count <= (int)UNROLLED_BLOCK_CAPACITY) {
+         memcpy(pBlock->students + pBlock->count, pNext->students, (size_t)pNext->count * sizeof(Student));
+         pBlock->count += pNext->count; /* Underflow: merge with the next block */
+         pBlock->pNextBlock = pNext->pNextBlock;
+         if (pList->pTail == pNext) pList->pTail = pBlock;
+         free(pNext);
+     } else {
+         int move = (int)UNROLLED_BLOCK_MIN - pBlock->count; /* Borrow from the next block */
+         memcpy(pBlock->students + pBlock->count, pNext->students, (size_t)move * sizeof(Student));
+         memmove(pNext->students, pNext->students + move, (size_t)(pNext->count - move) * sizeof(Student));
+         pBlock->count += move;
+         pNext->count -= move;
+     }
+ }
+ 
+ /**
+  * @brief Delete the student at a 0-based index
+  * @param pList Pointer to the unrolled list
+  * @param index Index in [0, studentCount)
+  */
+ static void deleteAt(UnrolledList *pList, int index) {
+     StudentBlock *pPrev = NULL;
+     StudentBlock *pBlock = pList->pHead;
+     while (index >= pBlock->count) {
+         index -= pBlock->count;
+         pPrev = pBlock;
+         pBlock = pBlock->pNextBlock;
+     }
+     memmove(pBlock->students + index, pBlock->students + index + 1,
+             (size_t)(pBlock->count - index - 1) * sizeof(Student));
+     pBlock->count--;
+     pList->studentCount--;
+     rebalance(pList, pPrev, pBlock);
+ }
+ 
+ /**
+  * @brief Get the student at a 0-based index
+  * @param pList Pointer to the unrolled list
+  * @param index Index in [0, studentCount)
+  * @return Pointer to the stored student
+  */
+ static Student* studentAt(UnrolledList *pList, int index) {
+     StudentBlock *pBlock = pList->pHead;
+     if (index == pList->studentCount - 1) {
+         return &pList->pTail->students[pList->pTail->count - 1];
+     }
+     while (index >= pBlock->count) {
+         index -= pBlock->count;
+         pBlock = pBlock->pNextBlock;
+     }
+     return &pBlock->students[index];
+ }
+ 
+ /**
+  * @brief Find the first student with a specific name
+  * @param pList Pointer to the unrolled list
+  * @param name Name to look for
+  * @return 0-based index of the student, or -1 if not found
+  */
+ static int findByName(UnrolledList *pList, const char *name) {
+     int base = 0;
+     for (StudentBlock *pBlock = pList->pHead; pBlock != NULL; pBlock = pBlock->pNextBlock) {
+         for (int i = 0; i < pBlock->count; i++) {
+             if (strcmp(pBlock->students[i].nameStudent, name) == 0) {
+                 return base + i;
+             }
+         }
+         base += pBlock->count;
+     }
+     return -1;
+ }
+ 
+ /**
+  * @brief Initialize the unrolled list
+  * @param pList Pointer to the unrolled list
+  */
+ void initUnrolledList(UnrolledList *pList) {
+     pList->pHead = NULL;
+     pList->pTail = NULL;
+     pList->studentCount = 0;
+ }
+ 
+ /**
+  * @brief Add a student to the head of the unrolled list
+  * @param pList Pointer to the unrolled list
+  * @param student Student data
+  */
+ void uAddHead(UnrolledList *pList, Student student) {
+     insertAt(pList, 0, student);
+ }
+ 
+ /**
+  * @brief Add a student to the tail of the unrolled list
+  * @param pList Pointer to the unrolled list
+  * @param student Student data
+  */
+ void uAddTail(UnrolledList *pList, Student student) {
+     insertAt(pList, pList->studentCount, student);
+ }
+ 
+ /**
+  * @brief Insert a new student before a student with a specific name
+  * @param pList Pointer to the unrolled list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert before
+  */
+ void uInsertBeforeStudent(UnrolledList *pList, Student newStudent, const char *nameTarget) {
+     int index = findByName(pList, nameTarget);
+     if (index < 0) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     insertAt(pList, index, newStudent);
+ }
+ 
+ /**
+  * @brief Insert a new student after a student with a specific name
+  * @param pList Pointer to the unrolled list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert after
+  */
+ void uInsertAfterStudent(UnrolledList *pList, Student newStudent, const char *nameTarget) {
+     int index = findByName(pList, nameTarget);
+     if (index < 0) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     insertAt(pList, index + 1, newStudent);
+ }
+ 
+ /**
+  * @brief Insert a new student at a specific position
+  * @param pList Pointer to the unrolled list
+  * @param newStudent New student data
+  * @param position Position to insert the student (1-based index)
+  */
+ void uInsertSpecificPosition(UnrolledList *pList, Student newStudent, int position) {
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     if (position > pList->studentCount + 1) {
+         printf("Position out of range!\n");
+         return;
+     }
+     insertAt(pList, position - 1, newStudent);
+ }
+ 
+ /**
+  * @brief Delete the head of the unrolled list
+  * @param pList Pointer to the unrolled list
+  */
+ void uDeleteHead(UnrolledList *pList) {
+     if (pList->studentCount == 0) {
+         printf("List is empty!\n");
+         return;
+     }
+     deleteAt(pList, 0);
+ }
+ 
+ /**
+  * @brief Delete the tail of the unrolled list
+  * @param pList Pointer to the unrolled list
+  */
+ void uDeleteLast(UnrolledList *pList) {
+     if (pList->studentCount == 0) {
+         printf("List is empty!\n");
+         return;
+     }
+     deleteAt(pList, pList->studentCount - 1);
+ }
+ 
+ /**
+  * @brief Delete the student before a student with a specific name
+  * @param pList Pointer to the unrolled list
+  * @param nameTarget Name of the target student
+  */
+ void uDeleteBeforeStudent(UnrolledList *pList, const char *nameTarget) {
+     if (pList->studentCount < 2) {
+         printf("Cannot delete before the first student!\n");
+         return;
+     }
+     int index = findByName(pList, nameTarget);
+     if (index < 0) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     if (index > 0) {
+         deleteAt(pList, index - 1);
+     }
+ }
+ 
+ /**
+  * @brief Delete the student after a student with a specific name
+  * @param pList Pointer to the unrolled list
+  * @param nameTarget Name of the target student
+  */
+ void uDeleteAfterStudent(UnrolledList *pList, const char *nameTarget) {
+     int index = findByName(pList, nameTarget);
+     if (index < 0) {
+         printf("Student with name %s not found!\n", nameTarget);
+         return;
+     }
+     if (index + 1 >= pList->studentCount) {
+         printf("No student after %s!\n", nameTarget);
+         return;
+     }
+     deleteAt(pList, index + 1);
+ }
+ 
+ /**
+  * @brief Delete a student at a specific position
+  * @param pList Pointer to the unrolled list
+  * @param position Position of the student to delete (1-based index)
+  */
+ void uDeleteSpecificPosition(UnrolledList *pList, int position) {
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     if (position == 1) {
+         uDeleteHead(pList);
+         return;
+     }
+     if (position > pList->studentCount) {
+         printf("Position out of range!\n");
+         return;
+     }
+     deleteAt(pList, position - 1);
+ }
+ 
+ /**
+  * @brief Edit the student at the head of the unrolled list
+  * @param pList Pointer to the unrolled list
+  * @param newStudent New student data
+  */
+ void uEditHead(UnrolledList *pList, Student newStudent) {
+     if (pList->studentCount == 0) {
+         printf("List is empty!\n");
+         return;
+     }
+     pList->pHead->students[0] = newStudent;
+ }
+ 
+ /**
+  * @brief Edit the student at the tail of the unrolled list
+  * @param pList Pointer to the unrolled list
+  * @param newStudent New student data
+  */
+ void uEditLast(UnrolledList *pList, Student newStudent) {
+     if (pList->studentCount == 0) {
+         printf("List is empty!\n");
+         return;
+     }
+     pList->pTail->students[pList->pTail->count - 1] = newStudent;
+ }
+ 
+ /**
+  * @brief Edit a student at a specific position
+  * @param pList Pointer to the unrolled list
+  * @param position Position of the student to edit (1-based index)
+  * @param newStudent New student data
+  */
+ void uEditSpecificPosition(UnrolledList *pList, int position, Student newStudent) {
+     if (position < 1) {
+         printf("Invalid position!\n");
+         return;
+     }
+     if (position > pList->studentCount) {
+         printf("Position out of range!\n");
+         return;
+     }
+     *studentAt(pList, position - 1) = newStudent;
+ }
+ 
+ /**
+  * @brief Free all blocks of the unrolled list
+  * @param pList Pointer to the unrolled list
+  */
+ void uFreeList(UnrolledList *pList) {
+     StudentBlock *pBlock = pList->pHead;
+     while (pBlock != NULL) {
+         StudentBlock *pNext = pBlock->pNextBlock;
+         free(pBlock);
+         pBlock = pNext;
+     }
+     initUnrolledList(pList);
+ }
+ 
+ /**
+  * @brief Stable sort of the unrolled list by several keys in priority order
+  * @param pList Pointer to the unrolled list
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
+  */
+ void uSortList(UnrolledList *pList, const SortKey *keys, int nkeys) {
+     int count = pList->studentCount;
+     Student *pAll;
+     int *pIndexBuffer;
+     int *pOrder;
+     int *pScratch;
+     int k = 0;
+ 
+     if (keys == NULL || nkeys < 1) {
+         printf("Invalid sort keys!\n");
+         return;
+     }
+     if (count < 2) return;
+     pAll = (Student*)malloc((size_t)count * sizeof(Student));
+     pIndexBuffer = (int*)malloc(2 * (size_t)count * sizeof(int));
+     if (pAll == NULL || pIndexBuffer == NULL) {
+         printf("Memory allocation failed!\n");
+         free(pAll);
+         free(pIndexBuffer);
+         return;
+     }
+     pOrder = pIndexBuffer;
+     pScratch = pIndexBuffer + count;
+     for (StudentBlock *pBlock = pList->pHead; pBlock != NULL; pBlock = pBlock->pNextBlock) {
+         memcpy(pAll + k, pBlock->students, (size_t)pBlock->count * sizeof(Student));
+         k += pBlock->count;
+     }
+     for (int i = 0; i < count; i++) pOrder[i] = i;
+     for (int width = 1; width < count; width *= 2) { /* Bottom-up merge of indices, stable */
+         for (int left = 0; left < count; left += 2 * width) {
+             int mid = (left + width < count) ? left + width : count;
+             int right = (left + 2 * width < count) ? left + 2 * width : count;
+             int i = left, j = mid, out = left;
+             while (i < mid && j < right) {
+                 pScratch[out++] = (compareStudentsByKeys(&pAll[pOrder[j]], &pAll[pOrder[i]], keys, nkeys) < 0)
+                                   ? pOrder[j++] : pOrder[i++];
+             }
+             while (i < mid) pScratch[out++] = pOrder[i++];
+             while (j < right) pScratch[out++] = pOrder[j++];
+         }
+         int *pSwap = pOrder;
+         pOrder = pScratch;
+         pScratch = pSwap;
+     }
+ 
+     /* Repack densely: full blocks in sorted order, surplus blocks released */
+     StudentBlock *pBlock = pList->pHead;
+     StudentBlock *pLast = NULL;
+     k = 0;
+     while (k < count) {
+         pBlock->count = 0;
+         while (pBlock->count < (int)UNROLLED_BLOCK_CAPACITY && k < count) {
+             pBlock->students[pBlock->count++] = pAll[pOrder[k++]];
+         }
+         pLast = pBlock;
+         pBlock = pBlock->pNextBlock;
+     }
+     pLast->pNextBlock = NULL;
+     pList->pTail = pLast;
+     while (pBlock != NULL) {
+         StudentBlock *pNext = pBlock->pNextBlock;
+         free(pBlock);
+         pBlock = pNext;
+     }
+     free(pAll);
+     free(pIndexBuffer);
+ }
+ 
+ /**
+  * @brief Sort the unrolled list by one field
+  * @param pList Pointer to the unrolled list
+  * @param field Field to sort by
+  * @param direction Sort direction
+  */
+ static void uSortBySingleKey(UnrolledList *pList, SortField_TypeDef field, SortDirection_TypeDef direction) {
+     SortKey key = { field, direction };
+     uSortList(pList, &key, 1);
+ }
+ 
+ /**
+  * @brief Sort the unrolled list by name in ascending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByNameAsc(UnrolledList *pList) {
+     uSortBySingleKey(pList, SORT_FIELD_NAME, SORT_ASCENDING);
+ }
+ 
+ /**
+  * @brief Sort the unrolled list by name in descending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByNameDesc(UnrolledList *pList) {
+     uSortBySingleKey(pList, SORT_FIELD_NAME, SORT_DESCENDING);
+ }
+ 
+ /**
+  * @brief Sort the unrolled list by GPA in ascending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByScoreAsc(UnrolledList *pList) {
+     uSortBySingleKey(pList, SORT_FIELD_GPA, SORT_ASCENDING);
+ }
+ 
+ /**
+  * @brief Sort the unrolled list by GPA in descending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByScoreDesc(UnrolledList *pList) {
+     uSortBySingleKey(pList, SORT_FIELD_GPA, SORT_DESCENDING);
+ }
+ 
+ /**
+  * @brief Sort the unrolled list by age in ascending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByAgeAsc(UnrolledList *pList) {
+     uSortBySingleKey(pList, SORT_FIELD_AGE, SORT_ASCENDING);
+ }
+ 
+ /**
+  * @brief Sort the unrolled list by age in descending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByAgeDesc(UnrolledList *pList) {
+     uSortBySingleKey(pList, SORT_FIELD_AGE, SORT_DESCENDING);
+ }
+ 
+ /**
+  * @brief Count the number of students in the unrolled list
+  * @param pList Pointer to the unrolled list
+  * @return Number of students in the list
+  */
+ int uCountStudents(UnrolledList *pList) {
+     return pList->studentCount;
+ }
@@ -0,0 +1,216 @@
+/**
+ ******************************************************************************
+ * @file    unrolledlist.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for unrolled linked list management
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef UNROLLEDLIST_H
+ #define UNROLLEDLIST_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include "linkedlist.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define UNROLLED_BLOCK_CAPACITY             (32U) /* Students per block */
+ #define UNROLLED_BLOCK_MIN                  (UNROLLED_BLOCK_CAPACITY / 2U) /* Merge below this */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Block of consecutive students
+  */
+ typedef struct StudentBlock {
+     struct StudentBlock *pNextBlock;            /* Pointer to the next block */
+     int count;                                  /* Students used in this block */
+     Student students[UNROLLED_BLOCK_CAPACITY];  /* Students stored in list order */
+ } StudentBlock;
+ 
+ /**
+  * @brief Unrolled linked list structure
+  * @note  Scan with: for each block, for i in [0, count) use students[i]
+  */
+ typedef struct UnrolledList {
+     StudentBlock *pHead;   /* Pointer to the first block */
+     StudentBlock *pTail;   /* Pointer to the last block */
+     int studentCount;      /* Number of students in the list */
+ } UnrolledList;
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Initialize the unrolled list
+  * @param pList Pointer to the unrolled list
+  */
+ void initUnrolledList(UnrolledList *pList);
+ 
+ /**
+  * @brief Add a student to the head of the unrolled list
+  * @param pList Pointer to the unrolled list
+  * @param student Student data
+  */
+ void uAddHead(UnrolledList *pList, Student student);
+ 
+ /**
+  * @brief Add a student to the tail of the unrolled list
+  * @param pList Pointer to the unrolled list
+  * @param student Student data
+  */
+ void uAddTail(UnrolledList *pList, Student student);
+ 
+ /**
+  * @brief Insert a new student before a student with a specific name
+  * @param pList Pointer to the unrolled list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert before
+  */
+ void uInsertBeforeStudent(UnrolledList *pList, Student newStudent, const char *nameTarget);
+ 
+ /**
+  * @brief Insert a new student after a student with a specific name
+  * @param pList Pointer to the unrolled list
+  * @param newStudent New student data
+  * @param nameTarget Name of the student to insert after
+  */
+ void uInsertAfterStudent(UnrolledList *pList, Student newStudent, const char *nameTarget);
+ 
+ /**
+  * @brief Insert a new student at a specific position
+  * @param pList Pointer to the unrolled list
+  * @param newStudent New student data
+  * @param position Position to insert the student (1-based index)
+  */
+ void uInsertSpecificPosition(UnrolledList *pList, Student newStudent, int position);
+ 
+ /**
+  * @brief Delete the head of the unrolled list
+  * @param pList Pointer to the unrolled list
+  */
+ void uDeleteHead(UnrolledList *pList);
+ 
+ /**
+  * @brief Delete the tail of the unrolled list
+  * @param pList Pointer to the unrolled list
+  */
+ void uDeleteLast(UnrolledList *pList);
+ 
+ /**
+  * @brief Delete the student before a student with a specific name
+  * @param pList Pointer to the unrolled list
+  * @param nameTarget Name of the target student
+  */
+ void uDeleteBeforeStudent(UnrolledList *pList, const char *nameTarget);
+ 
+ /**
+  * @brief Delete the student after a student with a specific name
+  * @param pList Pointer to the unrolled list
+  * @param nameTarget Name of the target student
+  */
+ void uDeleteAfterStudent(UnrolledList *pList, const char *nameTarget);
+ 
+ /**
+  * @brief Delete a student at a specific position
+  * @param pList Pointer to the unrolled list
+  * @param position Position of the student to delete (1-based index)
+  */
+ void uDeleteSpecificPosition(UnrolledList *pList, int position);
+ 
+ /**
+  * @brief Edit the student at the head of the unrolled list
+  * @param pList Pointer to the unrolled list
+  * @param newStudent New student data
+  */
+ void uEditHead(UnrolledList *pList, Student newStudent);
+ 
+ /**
+  * @brief Edit the student at the tail of the unrolled list
+  * @param pList Pointer to the unrolled list
+  * @param newStudent New student data
+  */
+ void uEditLast(UnrolledList *pList, Student newStudent);
+ 
+ /**
+  * @brief Edit a student at a specific position
+  * @param pList Pointer to the unrolled list
+  * @param position Position of the student to edit (1-based index)
+  * @param newStudent New student data
+  */
+ void uEditSpecificPosition(UnrolledList *pList, int position, Student newStudent);
+ 
+ /**
+  * @brief Free all blocks of the unrolled list
+  * @param pList Pointer to the unrolled list
+  */
+ void uFreeList(UnrolledList *pList);
+ 
+ /**
+  * @brief Stable sort of the unrolled list by several keys in priority order
+  * @param pList Pointer to the unrolled list
+  * @param keys Array of sort keys, most significant first
+  * @param nkeys Number of keys in the array
+  * @note  Students are repacked into full blocks afterwards
+  */
+ void uSortList(UnrolledList *pList, const SortKey *keys, int nkeys);
+ 
+ /**
+  * @brief Sort the unrolled list by name in ascending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByNameAsc(UnrolledList *pList);
+ 
+ /**
+  * @brief Sort the unrolled list by name in descending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByNameDesc(UnrolledList *pList);
+ 
+ /**
+  * @brief Sort the unrolled list by GPA in ascending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByScoreAsc(UnrolledList *pList);
+ 
+ /**
+  * @brief Sort the unrolled list by GPA in descending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByScoreDesc(UnrolledList *pList);
+ 
+ /**
+  * @brief Sort the unrolled list by age in ascending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByAgeAsc(UnrolledList *pList);
+ 
+ /**
+  * @brief Sort the unrolled list by age in descending order
+  * @param pList Pointer to the unrolled list
+  */
+ void uSortByAgeDesc(UnrolledList *pList);
+ 
+ /**
+  * @brief Count the number of students in the unrolled list
+  * @param pList Pointer to the unrolled list
+  * @return Number of students in the list
+  */
+ int uCountStudents(UnrolledList *pList);
+ 
+ #endif /* UNROLLEDLIST_H */
@@ -0,0 +1,128 @@
+/**
+ ******************************************************************************
+ * @file    workerthreads.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Implementation of the fork-join worker thread helper
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+ #define _POSIX_C_SOURCE 200809L
+ #endif
+ #ifdef _WIN32
+ #include <windows.h>
+ #else
+ #include <pthread.h>
+ #include <unistd.h>
+ #endif
+ #include "WorkerThreads.h"
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Task handed to a started thread
+  */
+ typedef struct WorkerStart {
+     WorkerTask_TypeDef pRun;       /* Function to run */
+     void *pTask;                   /* Its argument */
+ } WorkerStart;
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ #ifdef _WIN32
+ /**
+  * @brief Thread entry point
+  * @param pArg Pointer to a WorkerStart
+  * @return Always 0
+  */
+ static DWORD WINAPI workerEntry(LPVOID pArg) {
+     WorkerStart *pStart = (WorkerStart*)pArg;
+     pStart->pRun(pStart->pTask);
+     return 0;
+ }
+ #else
+ /**
+  * @brief Thread entry point
+  * @param pArg Pointer to a WorkerStart
+  * @return Always NULL
+  */
+ static void* workerEntry(void *pArg) {
+     WorkerStart *pStart = (WorkerStart*)pArg;
+     pStart->pRun(pStart->pTask);
+     return NULL;
+ }
+ #endif
+ 
+ /**
+  * @brief Get the number of hardware threads
+  * @return Online processor count, at least 1 and at most MAX_WORKER_THREADS
+  */
+ int hardwareThreadCount(void) {
+     long count;
+ #ifdef _WIN32
+     SYSTEM_INFO info;
+     GetSystemInfo(&info);
+     count = (long)info.dwNumberOfProcessors;
+ #else
+     count = sysconf(_SC_NPROCESSORS_ONLN);
+ #endif
+     if (count < 1) return 1;
+     return (count > MAX_WORKER_THREADS) ? MAX_WORKER_THREADS : (int)count;
+ }
+ 
+ /**
+  * @brief Run tasks on separate threads and wait for all of them
+  * @param pRun Function run once per task
+  * @param pTasks Array of task arguments
+  * @param taskSize Size of one task argument in bytes
+  * @param taskCount Number of tasks, at most MAX_WORKER_THREADS
+  */
+ void runWorkerTasks(WorkerTask_TypeDef pRun, void *pTasks, size_t taskSize, int taskCount) {
+     WorkerStart starts[MAX_WORKER_THREADS];
+     int started[MAX_WORKER_THREADS];
+ #ifdef _WIN32
+     HANDLE threads[MAX_WORKER_THREADS];
+ #else
+     pthread_t threads[MAX_WORKER_THREADS];
+ #endif
+     if (taskCount > MAX_WORKER_THREADS) taskCount = MAX_WORKER_THREADS;
+     for (int i = 1; i < taskCount; i++) {
+         starts[i].pRun = pRun;
+         starts[i].pTask = (char*)pTasks + (size_t)i * taskSize;
+ #ifdef _WIN32
+         threads[i] = CreateThread(NULL, 0, workerEntry, &starts[i], 0, NULL);
+         started[i] = (threads[i] != NULL);
+ #else
+         started[i] = (pthread_create(&threads[i], NULL, workerEntry, &starts[i]) == 0);
+ #endif
+     }
+     if (taskCount > 0) pRun(pTasks);
+     for (int i = 1; i < taskCount; i++) {
+         if (!started[i]) {
+             pRun(starts[i].pTask); /* No thread for it: run it here instead */
+             continue;
+         }
+ #ifdef _WIN32
+         WaitForSingleObject(threads[i], INFINITE);
+         CloseHandle(threads[i]);
+ #else
+         pthread_join(threads[i], NULL);
+ #endif
+     }
+ }
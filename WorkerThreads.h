@@ -0,0 +1,63 @@
+/**
+ ******************************************************************************
+ * @file    workerthreads.h
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Header file for the fork-join worker thread helper
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+ #ifndef WORKERTHREADS_H
+ #define WORKERTHREADS_H
+ 
+ /****************************************************************************** 
+  * INCLUDES
+  ******************************************************************************/
+ #include <stddef.h>
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define MAX_WORKER_THREADS                  (64)   /* Upper bound on threads used by one parallel call */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Task run by a worker thread
+  * @param pTask Pointer to the task's own argument
+  */
+ typedef void (*WorkerTask_TypeDef)(void *pTask);
+ 
+ /****************************************************************************** 
+  * API
+  ******************************************************************************/
+ /**
+  * @brief Get the number of hardware threads
+  * @return Online processor count, at least 1 and at most MAX_WORKER_THREADS
+  */
+ int hardwareThreadCount(void);
+ 
+ /**
+  * @brief Run tasks on separate threads and wait for all of them
+  * @param pRun Function run once per task
+  * @param pTasks Array of task arguments
+  * @param taskSize Size of one task argument in bytes
+  * @param taskCount Number of tasks, at most MAX_WORKER_THREADS
+  * @note  The first task runs on the calling thread. A task whose thread can't
+  *        be started also runs on the calling thread, so every task always
+  *        runs exactly once.
+  */
+ void runWorkerTasks(WorkerTask_TypeDef pRun, void *pTasks, size_t taskSize, int taskCount);
+ 
+ #endif /* WORKERTHREADS_H */
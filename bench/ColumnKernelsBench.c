@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @file    columnkernelsbench.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Benchmark of the aggregate kernels against a per-node loop
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -I. bench/ColumnKernelsBench.c $(ls *.c | grep -v main.c) -lm -pthread
+ * Run: ./a.out [students] [passes]
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include <time.h>
+ #include "StudentColumns.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define DEFAULT_STUDENTS                    (1000000) /* List size when none is given */
+ #define DEFAULT_PASSES                      (20)      /* Passes timed per kernel */
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Read the wall clock
+  * @return Seconds since an arbitrary origin
+  */
+ static double nowSeconds(void) {
+     struct timespec ts;
+     timespec_get(&ts, TIME_UTC);
+     return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+ }
+ 
+ /**
+  * @brief Compute the aggregates by walking the nodes, as before the column snapshot
+  * @param pList Pointer to the linked list
+  * @param pResult Receives the aggregates
+  */
+ static void aggregateNodes(const LinkedList *pList, StudentAggregates *pResult) {
+     memset(pResult, 0, sizeof(*pResult));
+     for (const Node *current = pList->pHead; current != NULL; current = current->pNextNode) {
+         float gpa = current->dataStudent.GPA;
+         int age = current->dataStudent.ageStudent;
+         if (gpa >= 3.5f) pResult->excellent++;
+         else if (gpa >= 3.0f) pResult->good++;
+         else if (gpa >= 2.0f) pResult->average++;
+         else pResult->weak++;
+         if (pResult->count == 0 || gpa < pResult->gpaMin) pResult->gpaMin = gpa;
+         if (pResult->count == 0 || gpa > pResult->gpaMax) pResult->gpaMax = gpa;
+         if (pResult->count == 0 || age < pResult->ageMin) pResult->ageMin = age;
+         if (pResult->count == 0 || age > pResult->ageMax) pResult->ageMax = age;
+         pResult->gpaSum += gpa;
+         pResult->ageSum += age;
+         pResult->count++;
+     }
+ }
+ 
+ /**
+  * @brief Check that two results have the same counts and extremes
+  * @param pA First result
+  * @param pB Second result
+  * @return 1 if they agree, 0 otherwise
+  */
+ static int sameAggregates(const StudentAggregates *pA, const StudentAggregates *pB) {
+     return pA->count == pB->count && pA->excellent == pB->excellent && pA->good == pB->good
+         && pA->average == pB->average && pA->weak == pB->weak && pA->ageSum == pB->ageSum
+         && pA->gpaMin == pB->gpaMin && pA->gpaMax == pB->gpaMax
+         && pA->ageMin == pB->ageMin && pA->ageMax == pB->ageMax;
+ }
+ 
+ /**
+  * @brief Time the per-node loop and every kernel, and print the results
+  * @param argc Argument count
+  * @param argv Optional list size and number of passes
+  * @return 0 on success, 1 if a kernel disagrees with the per-node loop
+  */
+ int main(int argc, char *argv[]) {
+     static const char *names[] = { "auto", "scalar", "sse2", "avx2" };
+     int count = (argc > 1) ? atoi(argv[1]) : DEFAULT_STUDENTS;
+     int passes = (argc > 2) ? atoi(argv[2]) : DEFAULT_PASSES;
+     StudentAggregates reference;
+     StudentColumns columns;
+     LinkedList list;
+     double start;
+     double nodeTime;
+     int failed = 0;
+     if (count < 1 || passes < 1) {
+         printf("Invalid arguments!\n");
+         return 1;
+     }
+     initLinkedList(&list);
+     srand(1);
+     for (int i = 0; i < count; i++) {
+         Student student;
+         memset(&student, 0, sizeof(student));
+         snprintf(student.nameStudent, sizeof(student.nameStudent), "Student%d", i);
+         student.ageStudent = 17 + rand() % 20;
+         student.GPA = (float)(rand() % 401) / 100.0f;
+         addTail(&list, createNode(student));
+     }
+     initStudentColumns(&columns);
+     if (!refreshStudentColumns(&columns, &list)) {
+         freeLinkedList(&list);
+         return 1;
+     }
+ 
+     start = nowSeconds();
+     for (int pass = 0; pass < passes; pass++) aggregateNodes(&list, &reference);
+     nodeTime = (nowSeconds() - start) / passes;
+     printf("%d students, %d passes, auto selects %s\n", count, passes, names[selectedAggregateKernel()]);
+     printf("%-10s\t%-12s\t%s\n", "Kernel", "ms per pass", "Speedup");
+     printf("%-10s\t%-12.3f\t%.1fx\n", "per-node", nodeTime * 1e3, 1.0);
+     for (int kernel = AGGREGATE_KERNEL_SCALAR; kernel <= AGGREGATE_KERNEL_AVX2; kernel++) {
+         StudentAggregates result;
+         double kernelTime;
+         if (!aggregateColumnsWith((AggregateKernel_TypeDef)kernel, columns.gpa, columns.age, columns.count, &result)) {
+             printf("%-10s\tnot available on this build or CPU\n", names[kernel]);
+             continue;
+         }
+         start = nowSeconds();
+         for (int pass = 0; pass < passes; pass++) {
+             aggregateColumnsWith((AggregateKernel_TypeDef)kernel, columns.gpa, columns.age, columns.count, &result);
+         }
+         kernelTime = (nowSeconds() - start) / passes;
+         printf("%-10s\t%-12.3f\t%.1fx%s\n", names[kernel], kernelTime * 1e3,
+                (kernelTime > 0.0) ? nodeTime / kernelTime : 0.0,
+                sameAggregates(&result, &reference) ? "" : "\tMISMATCH");
+         if (!sameAggregates(&result, &reference)) failed = 1;
+     }
+     freeStudentColumns(&columns);
+     freeLinkedList(&list);
+     destroyNodePool(getDefaultNodePool());
+     return failed;
+ }
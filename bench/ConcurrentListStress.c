@@ -0,0 +1,269 @@
+/**
+ ******************************************************************************
+ * @file    concurrentliststress.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Stress test of the concurrent list: writers and readers at once
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -I. bench/ConcurrentListStress.c $(ls *.c | grep -v main.c) -lm -pthread
+ * Run: ./a.out [writers] [readers] [operations per thread]
+ * Add -fsanitize=thread to check for data races as well.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include <time.h>
+ #include "ConcurrentList.h"
+ #include "WorkerThreads.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define DEFAULT_WRITERS                     (8)     /* Writer threads when none are given */
+ #define DEFAULT_READERS                     (8)     /* Reader threads when none are given */
+ #define DEFAULT_OPERATIONS                  (20000) /* Operations per thread when none are given */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief State shared by every thread of the run
+  * @note  Writer i owns anchor i: it is the only one to insert or delete
+  *        right after it, and deletes only what it inserted there, so no
+  *        anchor is ever removed and every operation must succeed.
+  *        headBalance counts head nodes not yet claimed by a cDeleteHead.
+  */
+ typedef struct StressShared {
+     ConcurrentList list;           /* List under test */
+     int writers;                   /* Number of writers, and of anchors */
+     atomic_int headBalance;        /* Nodes in front of the first anchor, free to delete */
+     atomic_int failures;           /* Operations that returned an unexpected result */
+ } StressShared;
+ 
+ /**
+  * @brief Argument of one stress thread
+  */
+ typedef struct StressTask {
+     StressShared *pShared;         /* State shared by every thread */
+     int id;                        /* Writer or reader number */
+     int isWriter;                  /* 1 for a writer, 0 for a reader */
+     int operations;                /* Operations to run */
+     long net;                      /* Writers: students added minus students deleted */
+ } StressTask;
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Read the wall clock
+  * @return Seconds since an arbitrary origin
+  */
+ static double nowSeconds(void) {
+     struct timespec ts;
+     timespec_get(&ts, TIME_UTC);
+     return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+ }
+ 
+ /**
+  * @brief Make a student with a name built from a prefix and two numbers
+  * @param prefix Name prefix
+  * @param a First number
+  * @param b Second number
+  * @return Student
+  */
+ static Student makeStudent(const char *prefix, int a, int b) {
+     Student student;
+     memset(&student, 0, sizeof(student));
+     snprintf(student.nameStudent, sizeof(student.nameStudent), "%s%d-%d", prefix, a, b);
+     student.ageStudent = 18 + b % 10;
+     student.GPA = (float)(b % 41) / 10.0f;
+     return student;
+ }
+ 
+ /**
+  * @brief Next value of a per-thread pseudo-random sequence
+  * @param pState Generator state
+  * @return Pseudo-random value
+  */
+ static unsigned int nextRandom(unsigned int *pState) {
+     *pState = *pState * 1103515245U + 12345U;
+     return *pState >> 16;
+ }
+ 
+ /**
+  * @brief Count one student of a reader's walk
+  * @param pStudent Student visited
+  * @param pContext Pointer to the count
+  */
+ static void countStudent(const Student *pStudent, void *pContext) {
+     (void)pStudent;
+     (*(int*)pContext)++;
+ }
+ 
+ /**
+  * @brief Run a writer: adds, inserts after its anchor and deletes
+  * @param pTask Pointer to the task
+  */
+ static void runWriter(StressTask *pTask) {
+     StressShared *pShared = pTask->pShared;
+     Student anchor = makeStudent("Anchor", pTask->id, 0);
+     unsigned int seed = 7U + (unsigned int)pTask->id;
+     int owned = 0; /* Students this writer inserted after its anchor and did not delete */
+     for (int i = 0; i < pTask->operations; i++) {
+         Student student = makeStudent("W", pTask->id, i);
+         int ok = 1;
+         switch (nextRandom(&seed) % 5) {
+             case 0:
+                 ok = cAddHead(&pShared->list, student);
+                 if (ok) atomic_fetch_add(&pShared->headBalance, 1);
+                 pTask->net += ok;
+                 break;
+             case 1:
+                 ok = cAddTail(&pShared->list, student);
+                 pTask->net += ok;
+                 break;
+             case 2:
+                 ok = cInsertAfterStudent(&pShared->list, student, anchor.nameStudent);
+                 owned += ok;
+                 pTask->net += ok;
+                 break;
+             case 3:
+                 if (owned == 0) break;
+                 ok = cDeleteAfterStudent(&pShared->list, anchor.nameStudent);
+                 owned -= ok;
+                 pTask->net -= ok;
+                 break;
+             default: {
+                 int balance = atomic_load(&pShared->headBalance);
+                 while (balance > 0 && !atomic_compare_exchange_weak(&pShared->headBalance, &balance, balance - 1)) {
+                     /* balance was reloaded: retry */
+                 }
+                 if (balance <= 0) break; /* Nothing in front of the anchors to delete */
+                 ok = cDeleteHead(&pShared->list, NULL);
+                 pTask->net -= ok;
+                 break;
+             }
+         }
+         if (!ok) atomic_fetch_add(&pShared->failures, 1);
+     }
+ }
+ 
+ /**
+  * @brief Run a reader: walks the list and looks up anchors, which never go away
+  * @param pTask Pointer to the task
+  */
+ static void runReader(StressTask *pTask) {
+     StressShared *pShared = pTask->pShared;
+     unsigned int seed = 101U + (unsigned int)pTask->id;
+     for (int i = 0; i < pTask->operations; i++) {
+         if (i % 64 == 0) {
+             int walked = 0;
+             cForEachStudent(&pShared->list, countStudent, &walked);
+             if (walked < pShared->writers) atomic_fetch_add(&pShared->failures, 1);
+         } else {
+             Student anchor = makeStudent("Anchor", (int)(nextRandom(&seed) % (unsigned int)pShared->writers), 0);
+             if (!cFindStudent(&pShared->list, anchor.nameStudent, NULL)) atomic_fetch_add(&pShared->failures, 1);
+         }
+     }
+ }
+ 
+ /**
+  * @brief Run one stress task
+  * @param pTask Pointer to a StressTask
+  */
+ static void runStressTask(void *pTask) {
+     StressTask *pStress = (StressTask*)pTask;
+     if (pStress->isWriter) {
+         runWriter(pStress);
+     } else {
+         runReader(pStress);
+     }
+ }
+ 
+ /**
+  * @brief Walk the chain directly and check that names are unique and anchors in order
+  * @param pShared Shared state, no thread running
+  * @param pLength Receives the number of nodes walked
+  * @return 1 if the chain is well formed, 0 otherwise
+  */
+ static int checkChain(StressShared *pShared, int *pLength) {
+     int length = 0;
+     int nextAnchor = 0;
+     for (CNode *pNode = atomic_load(&pShared->list.head.pNextNode); pNode != NULL;
+          pNode = atomic_load(&pNode->pNextNode)) {
+         Student anchor = makeStudent("Anchor", nextAnchor, 0);
+         if (pNode->removed) return 0;
+         if (nextAnchor < pShared->writers && strcmp(pNode->dataStudent.nameStudent, anchor.nameStudent) == 0) {
+             nextAnchor++;
+         }
+         length++;
+     }
+     *pLength = length;
+     return nextAnchor == pShared->writers;
+ }
+ 
+ /**
+  * @brief Run writers and readers together, then check the totals
+  * @param argc Argument count
+  * @param argv Optional writer count, reader count and operations per thread
+  * @return 0 if no update was lost, 1 otherwise
+  */
+ int main(int argc, char *argv[]) {
+     static StressTask tasks[MAX_WORKER_THREADS];
+     static StressShared shared;
+     int writers = (argc > 1) ? atoi(argv[1]) : DEFAULT_WRITERS;
+     int readers = (argc > 2) ? atoi(argv[2]) : DEFAULT_READERS;
+     int operations = (argc > 3) ? atoi(argv[3]) : DEFAULT_OPERATIONS;
+     long expected;
+     int counted;
+     int walked = 0;
+     int wellFormed;
+     double start;
+     if (writers < 1 || readers < 0 || writers + readers > MAX_WORKER_THREADS || operations < 1) {
+         printf("Invalid arguments! Use 1 or more writers and at most %d threads.\n", MAX_WORKER_THREADS);
+         return 1;
+     }
+     if (!initConcurrentList(&shared.list)) return 1;
+     shared.writers = writers;
+     atomic_init(&shared.headBalance, 0);
+     atomic_init(&shared.failures, 0);
+     for (int i = 0; i < writers; i++) cAddTail(&shared.list, makeStudent("Anchor", i, 0));
+     for (int i = 0; i < writers + readers; i++) {
+         tasks[i].pShared = &shared;
+         tasks[i].id = (i < writers) ? i : i - writers;
+         tasks[i].isWriter = (i < writers);
+         tasks[i].operations = operations;
+         tasks[i].net = 0;
+     }
+ 
+     start = nowSeconds();
+     runWorkerTasks(runStressTask, tasks, sizeof(StressTask), writers + readers);
+     printf("%d writers, %d readers, %d operations each: %.3f s\n", writers, readers, operations, nowSeconds() - start);
+ 
+     expected = writers;
+     for (int i = 0; i < writers; i++) expected += tasks[i].net;
+     counted = cCountNodes(&shared.list);
+     wellFormed = checkChain(&shared, &walked);
+     printf("Expected %ld students, cCountNodes %d, chain walk %d, failed operations %d, anchors %s\n",
+            expected, counted, walked, atomic_load(&shared.failures), wellFormed ? "intact" : "BROKEN");
+     cFreeList(&shared.list);
+     if (counted != expected || walked != expected || atomic_load(&shared.failures) != 0 || !wellFormed) {
+         printf("FAILED: updates were lost\n");
+         return 1;
+     }
+     printf("OK: no lost updates\n");
+     return 0;
+ }
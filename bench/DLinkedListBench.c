@@ -0,0 +1,170 @@
+/**
+ ******************************************************************************
+ * @file    dlinkedlistbench.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Benchmark of the doubly linked list against the singly linked list
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -I. bench/DLinkedListBench.c $(ls *.c | grep -v main.c) -lm -pthread
+ * Run: ./a.out [students]
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include <time.h>
+ #include "DLinkedList.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define DEFAULT_STUDENTS                    (20000) /* List size when none is given */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Operation timed on both lists
+  */
+ typedef enum {
+     BENCH_DELETE_LAST,             /* Delete the tail until half the list is gone */
+     BENCH_EDIT_POSITION,           /* Edit random positions */
+     BENCH_INSERT_POSITION,         /* Insert at random positions */
+     BENCH_DELETE_BEFORE            /* Delete before the tail student by name */
+ } BenchOp_TypeDef;
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Read the wall clock
+  * @return Seconds since an arbitrary origin
+  */
+ static double nowSeconds(void) {
+     struct timespec ts;
+     timespec_get(&ts, TIME_UTC);
+     return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+ }
+ 
+ /**
+  * @brief Make the student stored at an index
+  * @param i Index
+  * @return Student with a unique name
+  */
+ static Student makeStudent(int i) {
+     Student student;
+     memset(&student, 0, sizeof(student));
+     snprintf(student.nameStudent, sizeof(student.nameStudent), "Student%d", i);
+     student.ageStudent = 18 + i % 10;
+     student.GPA = (float)(i % 41) / 10.0f;
+     return student;
+ }
+ 
+ /**
+  * @brief Time one operation on the singly linked list
+  * @param op Operation
+  * @param count Students in the list before the run
+  * @return Seconds taken by the operations, setup excluded
+  */
+ static double runSingly(BenchOp_TypeDef op, int count) {
+     LinkedList list;
+     double start;
+     double elapsed;
+     int steps = count / 2;
+     initLinkedList(&list);
+     for (int i = 0; i < count; i++) addTail(&list, createNode(makeStudent(i)));
+     srand(1);
+     start = nowSeconds();
+     for (int i = 0; i < steps; i++) {
+         switch (op) {
+             case BENCH_DELETE_LAST:
+                 deleteLast(&list);
+                 break;
+             case BENCH_EDIT_POSITION:
+                 editSpecificPosition(&list, 1 + rand() % count, makeStudent(count + i));
+                 break;
+             case BENCH_INSERT_POSITION:
+                 insertSpecificPosition(&list, makeStudent(count + i), 1 + rand() % (count + i));
+                 break;
+             case BENCH_DELETE_BEFORE:
+                 deleteBeforeStudent(&list, list.pTail->dataStudent.nameStudent);
+                 break;
+         }
+     }
+     elapsed = nowSeconds() - start;
+     freeLinkedList(&list);
+     return elapsed;
+ }
+ 
+ /**
+  * @brief Time one operation on the doubly linked list
+  * @param op Operation
+  * @param count Students in the list before the run
+  * @return Seconds taken by the operations, setup excluded
+  */
+ static double runDoubly(BenchOp_TypeDef op, int count) {
+     DLinkedList list;
+     double start;
+     double elapsed;
+     int steps = count / 2;
+     initDLinkedList(&list);
+     for (int i = 0; i < count; i++) dAddTail(&list, createDNode(makeStudent(i)));
+     srand(1);
+     start = nowSeconds();
+     for (int i = 0; i < steps; i++) {
+         switch (op) {
+             case BENCH_DELETE_LAST:
+                 dDeleteLast(&list);
+                 break;
+             case BENCH_EDIT_POSITION:
+                 dEditSpecificPosition(&list, 1 + rand() % count, makeStudent(count + i));
+                 break;
+             case BENCH_INSERT_POSITION:
+                 dInsertSpecificPosition(&list, makeStudent(count + i), 1 + rand() % (count + i));
+                 break;
+             case BENCH_DELETE_BEFORE:
+                 dDeleteBeforeStudent(&list, list.pTail->dataStudent.nameStudent);
+                 break;
+         }
+     }
+     elapsed = nowSeconds() - start;
+     dFreeLinkedList(&list);
+     return elapsed;
+ }
+ 
+ /**
+  * @brief Run every operation on both lists and print the timings
+  * @param argc Argument count
+  * @param argv Optional list size
+  * @return 0 on success
+  */
+ int main(int argc, char *argv[]) {
+     static const char *names[] = { "deleteLast", "editSpecificPosition", "insertSpecificPosition", "deleteBeforeStudent" };
+     int count = (argc > 1) ? atoi(argv[1]) : DEFAULT_STUDENTS;
+     if (count < 2) {
+         printf("Invalid number of students!\n");
+         return 1;
+     }
+     printf("%d students, %d operations each\n", count, count / 2);
+     printf("%-24s\t%-12s\t%-12s\t%s\n", "Operation", "Singly (s)", "Doubly (s)", "Speedup");
+     for (int op = BENCH_DELETE_LAST; op <= BENCH_DELETE_BEFORE; op++) {
+         double singly = runSingly((BenchOp_TypeDef)op, count);
+         double doubly = runDoubly((BenchOp_TypeDef)op, count);
+         printf("%-24s\t%-12.4f\t%-12.4f\t%.1fx\n", names[op], singly, doubly,
+                (doubly > 0.0) ? singly / doubly : 0.0);
+     }
+     destroyNodePool(getDefaultNodePool());
+     return 0;
+ }
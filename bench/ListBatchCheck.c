@@ -0,0 +1,207 @@
+/**
+ ******************************************************************************
+ * @file    listbatchcheck.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Check that applyBatch matches the single-mutation functions
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -I. bench/ListBatchCheck.c $(ls *.c | grep -v main.c) -lm -pthread
+ * Run: ./a.out [batches]
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #include "ListBatch.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define DEFAULT_BATCHES                     (3000) /* Random batches per mode when none are given */
+ #define MAX_BATCH_OPS                       (40)   /* Largest batch tried */
+ #define NAME_COUNT                          (8)    /* Names to draw from, so duplicates are common */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief List setup a batch is checked under
+  */
+ typedef enum {
+     CHECK_PLAIN,                   /* Positions as inserted */
+     CHECK_INDEXED,                 /* Name and positional indexes enabled */
+     CHECK_ORDERED                  /* Maintained order by GPA descending, then name */
+ } CheckMode_TypeDef;
+ 
+ /****************************************************************************** 
+  * VARIABLES
+  ******************************************************************************/
+ static const char *names[NAME_COUNT] = { "An", "Binh", "Chi", "Dung", "Em", "Giang", "Hoa", "Khoa" };
+ static int serial = 0;             /* Age of the next student made, tells equal names apart */
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Make a student with one of the shared names and a fresh age
+  * @param name Index into names
+  * @return Student
+  */
+ static Student makeStudent(int name) {
+     Student student;
+     memset(&student, 0, sizeof(student));
+     snprintf(student.nameStudent, sizeof(student.nameStudent), "%s", names[name]);
+     student.ageStudent = serial++;
+     student.GPA = (float)(rand() % 5); /* Few values, so the order has many ties */
+     return student;
+ }
+ 
+ /**
+  * @brief Apply one mutation through the single-mutation functions
+  * @param pList Pointer to the linked list
+  * @param pOp Mutation
+  * @return Its outcome, as applyBatch reports it
+  * @note  The outcome is checked first and the function only called when it
+  *        applies, so nothing is printed.
+  */
+ static BatchStatus_TypeDef applyOne(LinkedList *pList, const BatchOp *pOp) {
+     Node *pTarget;
+     if (pOp->kind == BATCH_EDIT_POSITION) {
+         if (pOp->position < 1) return BATCH_INVALID_POSITION;
+         if (pOp->position > pList->nodeCount) return BATCH_OUT_OF_RANGE;
+         editSpecificPosition(pList, pOp->position, pOp->student);
+         return BATCH_OK;
+     }
+     if ((pOp->kind != BATCH_INSERT_AFTER && pOp->kind != BATCH_DELETE_AFTER) || pOp->nameTarget == NULL) {
+         return BATCH_INVALID_OP;
+     }
+     pTarget = findStudentByName(pList, pOp->nameTarget);
+     if (pTarget == NULL) return BATCH_NOT_FOUND;
+     if (pOp->kind == BATCH_INSERT_AFTER) {
+         insertAfterStudent(pList, pOp->student, pOp->nameTarget);
+     } else if (pTarget->pNextNode == NULL) {
+         return BATCH_NO_NEXT;
+     } else {
+         deleteAfterStudent(pList, pOp->nameTarget);
+     }
+     return BATCH_OK;
+ }
+ 
+ /**
+  * @brief Check that two lists hold the same students in the same order
+  * @param pA First list
+  * @param pB Second list
+  * @return 1 if they match, 0 otherwise
+  */
+ static int sameList(LinkedList *pA, LinkedList *pB) {
+     const Node *a = pA->pHead;
+     const Node *b = pB->pHead;
+     if (pA->nodeCount != pB->nodeCount) return 0;
+     for (; a != NULL && b != NULL; a = a->pNextNode, b = b->pNextNode) {
+         if (strcmp(a->dataStudent.nameStudent, b->dataStudent.nameStudent) != 0
+             || a->dataStudent.ageStudent != b->dataStudent.ageStudent) {
+             return 0;
+         }
+     }
+     if (a != NULL || b != NULL) return 0;
+     for (int i = 0; i < NAME_COUNT; i++) { /* Name lookups, through the index if enabled */
+         const Node *pFoundA = findStudentByName(pA, names[i]);
+         const Node *pFoundB = findStudentByName(pB, names[i]);
+         if ((pFoundA == NULL) != (pFoundB == NULL)) return 0;
+         if (pFoundA != NULL && pFoundA->dataStudent.ageStudent != pFoundB->dataStudent.ageStudent) return 0;
+     }
+     return 1;
+ }
+ 
+ /**
+  * @brief Run one random batch both ways and compare
+  * @param mode List setup
+  * @return 1 if the batch matched the single mutations, 0 otherwise
+  */
+ static int checkBatch(CheckMode_TypeDef mode) {
+     static const SortKey order[] = { { SORT_FIELD_GPA, SORT_DESCENDING }, { SORT_FIELD_NAME, SORT_ASCENDING } };
+     BatchOp ops[MAX_BATCH_OPS];
+     BatchStatus_TypeDef expected[MAX_BATCH_OPS];
+     BatchStatus_TypeDef status[MAX_BATCH_OPS];
+     LinkedList sequential;
+     LinkedList batched;
+     int nameCount = 1 + rand() % NAME_COUNT;
+     int count = rand() % ((rand() % 10 == 0) ? 200 : 12);
+     int opCount = rand() % (MAX_BATCH_OPS + 1);
+     int expectedApplied = 0;
+     int applied;
+     int same;
+     initLinkedList(&sequential);
+     initLinkedList(&batched);
+     for (int i = 0; i < count; i++) {
+         Student student = makeStudent(rand() % nameCount);
+         addTail(&sequential, createNode(student));
+         addTail(&batched, createNode(student));
+     }
+     if (mode == CHECK_INDEXED) {
+         enableNameIndex(&batched);
+         enablePositionIndex(&batched);
+     } else if (mode == CHECK_ORDERED) {
+         setMaintainedOrder(&sequential, order, 2);
+         setMaintainedOrder(&batched, order, 2);
+     }
+     for (int i = 0; i < opCount; i++) {
+         int kind = rand() % 10;
+         memset(&ops[i], 0, sizeof(ops[i]));
+         ops[i].kind = (kind < 4) ? BATCH_INSERT_AFTER : (kind < 7) ? BATCH_DELETE_AFTER : BATCH_EDIT_POSITION;
+         if (kind == 9 && rand() % 5 == 0) ops[i].kind = (BatchOpKind_TypeDef)7; /* Unknown kind */
+         ops[i].nameTarget = (rand() % 20 == 0) ? NULL : names[rand() % NAME_COUNT];
+         ops[i].position = rand() % (count + 4) - 1;
+         ops[i].student = makeStudent(rand() % NAME_COUNT);
+     }
+ 
+     for (int i = 0; i < opCount; i++) {
+         expected[i] = applyOne(&sequential, &ops[i]);
+         if (expected[i] == BATCH_OK) expectedApplied++;
+     }
+     applied = applyBatch(&batched, ops, (size_t)opCount, status);
+     same = (applied == expectedApplied) && sameList(&sequential, &batched)
+         && memcmp(status, expected, (size_t)opCount * sizeof(status[0])) == 0;
+     freeLinkedList(&sequential);
+     freeLinkedList(&batched);
+     return same;
+ }
+ 
+ /**
+  * @brief Compare applyBatch with the single-mutation functions on random batches
+  * @param argc Argument count
+  * @param argv Optional number of batches per mode
+  * @return 0 if every batch matched, 1 otherwise
+  */
+ int main(int argc, char *argv[]) {
+     static const char *modes[] = { "plain", "indexed", "ordered" };
+     int batches = (argc > 1) ? atoi(argv[1]) : DEFAULT_BATCHES;
+     int failed = 0;
+     if (batches < 1) {
+         printf("Invalid number of batches!\n");
+         return 1;
+     }
+     srand(7);
+     for (int mode = CHECK_PLAIN; mode <= CHECK_ORDERED; mode++) {
+         int mismatches = 0;
+         for (int i = 0; i < batches; i++) {
+             if (!checkBatch((CheckMode_TypeDef)mode)) mismatches++;
+         }
+         printf("%-10s\t%d batches\t%d mismatches\n", modes[mode], batches, mismatches);
+         if (mismatches != 0) failed = 1;
+     }
+     destroyNodePool(getDefaultNodePool());
+     return failed;
+ }
@@ -0,0 +1,232 @@
+/**
+ ******************************************************************************
+ * @file    mpsclistbench.c
+ * @author  
+ * @date    17 Oct 2026
+ * @brief   Throughput of the lock-free log against a mutex-wrapped list
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 mhoangkma (Github)
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -I. bench/MpscListBench.c $(ls *.c | grep -v main.c) -lm -pthread
+ * Run: ./a.out [students per producer]
+ * Numbers are only meaningful on a machine with at least 17 hardware threads.
+ *
+ ******************************************************************************
+ */
+
+/****************************************************************************** 
+ * INCLUDES
+ ******************************************************************************/
+ #if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+ #define _POSIX_C_SOURCE 200809L
+ #endif
+ #include <time.h>
+ #ifdef _WIN32
+ #include <windows.h>
+ #else
+ #include <pthread.h>
+ #endif
+ #include "MpscList.h"
+ #include "WorkerThreads.h"
+ 
+ /****************************************************************************** 
+  * MACRO
+  ******************************************************************************/
+ #define DEFAULT_STUDENTS                    (100000) /* Students per producer when none are given */
+ #define MAX_PRODUCERS                       (16)     /* Largest producer count measured */
+ 
+ /****************************************************************************** 
+  * DEFINITIONS
+  ******************************************************************************/
+ /**
+  * @brief Mutex-wrapped linked list, the baseline
+  */
+ typedef struct LockedList {
+     LinkedList list;               /* List, only touched under lock */
+ #ifdef _WIN32
+     SRWLOCK lock;                  /* Guards list and the default node pool */
+ #else
+     pthread_mutex_t lock;          /* Guards list and the default node pool */
+ #endif
+ } LockedList;
+ 
+ /**
+  * @brief Argument of one producer or of the consumer
+  */
+ typedef struct BenchTask {
+     int useLog;                    /* 1 for the lock-free log, 0 for the locked list */
+     int producer;                  /* Producer number, -1 for the consumer */
+     int producers;                 /* Number of producers in the run */
+     int students;                  /* Students per producer */
+     int outOfOrder;                /* Consumer: students seen out of their producer's order */
+ } BenchTask;
+ 
+ /****************************************************************************** 
+  * VARIABLES
+  ******************************************************************************/
+ static MpscList benchLog;          /* Static, so pTail keeps its cache line alignment */
+ static LockedList lockedList;      /* Baseline list */
+ 
+ /****************************************************************************** 
+  * CODE
+  ******************************************************************************/
+ /**
+  * @brief Lock helpers over the pthread and Win32 primitives
+  */
+ #ifdef _WIN32
+ static void initListLock(LockedList *pList) { InitializeSRWLock(&pList->lock); }
+ static void destroyListLock(LockedList *pList) { (void)pList; }
+ static void lockList(LockedList *pList) { AcquireSRWLockExclusive(&pList->lock); }
+ static void unlockList(LockedList *pList) { ReleaseSRWLockExclusive(&pList->lock); }
+ #else
+ static void initListLock(LockedList *pList) { pthread_mutex_init(&pList->lock, NULL); }
+ static void destroyListLock(LockedList *pList) { pthread_mutex_destroy(&pList->lock); }
+ static void lockList(LockedList *pList) { pthread_mutex_lock(&pList->lock); }
+ static void unlockList(LockedList *pList) { pthread_mutex_unlock(&pList->lock); }
+ #endif
+ 
+ /**
+  * @brief Read the wall clock
+  * @return Seconds since an arbitrary origin
+  */
+ static double nowSeconds(void) {
+     struct timespec ts;
+     timespec_get(&ts, TIME_UTC);
+     return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+ }
+ 
+ /**
+  * @brief Append students, tagged with the producer and a sequence number
+  * @param pTask Pointer to the task
+  */
+ static void runProducer(BenchTask *pTask) {
+     Student student;
+     memset(&student, 0, sizeof(student));
+     snprintf(student.nameStudent, sizeof(student.nameStudent), "Producer%d", pTask->producer);
+     student.ageStudent = pTask->producer;
+     for (int i = 0; i < pTask->students; i++) {
+         student.GPA = (float)i; /* Exact below 2^24 */
+         if (pTask->useLog) {
+             MNode *pNode = createMNode(student);
+             if (pNode == NULL) exit(1);
+             mAddTailNode(&benchLog, pNode);
+         } else {
+             lockList(&lockedList);
+             addTail(&lockedList.list, createNode(student)); /* The pool is not thread-safe either */
+             unlockList(&lockedList);
+         }
+     }
+ }
+ 
+ /**
+  * @brief Remove every student and check each producer's students come in order
+  * @param pTask Pointer to the task
+  */
+ static void runConsumer(BenchTask *pTask) {
+     long total = (long)pTask->producers * pTask->students;
+     float last[MAX_PRODUCERS];
+     for (int i = 0; i < MAX_PRODUCERS; i++) last[i] = -1.0f;
+     for (long consumed = 0; consumed < total; ) {
+         Student student;
+         int got = 0;
+         if (pTask->useLog) {
+             got = mDeleteHead(&benchLog, &student);
+         } else {
+             lockList(&lockedList);
+             if (lockedList.list.pHead != NULL) {
+                 student = lockedList.list.pHead->dataStudent;
+                 deleteHead(&lockedList.list);
+                 got = 1;
+             }
+             unlockList(&lockedList);
+         }
+         if (!got) continue;
+         if (student.GPA <= last[student.ageStudent]) pTask->outOfOrder++;
+         last[student.ageStudent] = student.GPA;
+         consumed++;
+     }
+ }
+ 
+ /**
+  * @brief Run one producer or the consumer
+  * @param pTask Pointer to a BenchTask
+  */
+ static void runBenchTask(void *pTask) {
+     BenchTask *pBench = (BenchTask*)pTask;
+     if (pBench->producer < 0) {
+         runConsumer(pBench);
+     } else {
+         runProducer(pBench);
+     }
+ }
+ 
+ /**
+  * @brief Time producers and one consumer on the log or on the locked list
+  * @param useLog 1 for the lock-free log, 0 for the locked list
+  * @param producers Number of producer threads
+  * @param students Students per producer
+  * @param pOutOfOrder Receives the number of students seen out of order
+  * @return Seconds until the consumer removed the last student
+  */
+ static double runBench(int useLog, int producers, int students, int *pOutOfOrder) {
+     BenchTask tasks[MAX_PRODUCERS + 1];
+     double start;
+     double elapsed;
+     for (int i = 0; i <= producers; i++) {
+         tasks[i].useLog = useLog;
+         tasks[i].producer = (i < producers) ? i : -1; /* Consumer last: it must not run before them on one thread */
+         tasks[i].producers = producers;
+         tasks[i].students = students;
+         tasks[i].outOfOrder = 0;
+     }
+     start = nowSeconds();
+     runWorkerTasks(runBenchTask, tasks, sizeof(BenchTask), producers + 1);
+     elapsed = nowSeconds() - start;
+     *pOutOfOrder = tasks[producers].outOfOrder;
+     return elapsed;
+ }
+ 
+ /**
+  * @brief Measure both lists at 1, 4, 8 and 16 producers and print the throughput
+  * @param argc Argument count
+  * @param argv Optional students per producer
+  * @return 0 on success, 1 if a student was lost or reordered
+  */
+ int main(int argc, char *argv[]) {
+     static const int producerCounts[] = { 1, 4, 8, 16 };
+     int students = (argc > 1) ? atoi(argv[1]) : DEFAULT_STUDENTS;
+     int failed = 0;
+     if (students < 1 || students > (1 << 24)) {
+         printf("Invalid number of students! Use 1 to %d.\n", 1 << 24);
+         return 1;
+     }
+     initMpscList(&benchLog);
+     initLinkedList(&lockedList.list);
+     initListLock(&lockedList);
+     printf("%d students per producer, 1 consumer, %d hardware threads\n", students, hardwareThreadCount());
+     printf("%-10s\t%-16s\t%-16s\t%s\n", "Producers", "Mutex (M/s)", "Lock-free (M/s)", "Speedup");
+     for (size_t i = 0; i < sizeof(producerCounts) / sizeof(producerCounts[0]); i++) {
+         int producers = producerCounts[i];
+         double total = (double)producers * students;
+         int lockedOrder;
+         int logOrder;
+         double locked = runBench(0, producers, students, &lockedOrder);
+         double lockFree = runBench(1, producers, students, &logOrder);
+         printf("%-10d\t%-16.2f\t%-16.2f\t%.1fx%s\n", producers, total / locked / 1e6, total / lockFree / 1e6,
+                locked / lockFree, (lockedOrder + logOrder != 0) ? "\tOUT OF ORDER" : "");
+         if (lockedOrder + logOrder != 0) failed = 1;
+     }
+     mFreeList(&benchLog);
+     freeLinkedList(&lockedList.list);
+     destroyListLock(&lockedList);
+     destroyNodePool(getDefaultNodePool());
+     return failed;
+ }
@@ -25,6 +25,10 @@
  #include <stdlib.h>
  #include <stdint.h>
  #include "linkedlist.h"
+ #include "StudentColumns.h"
+ #include "RosterView.h"
+ #include "StudentImport.h"
+ #include "ReportWriter.h"
  
  /****************************************************************************** 
   * MACRO
@@ -32,17 +36,7 @@
  /** @defgroup Length of name
   * @{
   */
- #define MIN_NAME_LENGTH                     (2U)
- #define MIN_ACCOUNT_LENGTH                  (6U)
- /**
-  * @}
-  */
- 
- /** @defgroup Score range
-  * @{
-  */
- #define MAX_GPA_SCALE                       ((double)10U)
- #define MIN_GPA_SCALE                       (0)
+ #define MIN_ACCOUNT_LENGTH                  (6U) /* Name and GPA limits live in studentimport.h */
  /**
   * @}
   */
@@ -111,13 +105,19 @@
      STUDENT_SORT,                   /* Sort students */
      STUDENT_OUTPUT,                 /* Output student list */
      STUDENT_SAVE_TO_FILE,           /* Save to file */
+     STUDENT_SAVE_BINARY,            /* Save to a binary roster file */
+     STUDENT_LOAD_BINARY,            /* Load from a binary roster file */
+     STUDENT_VIEW_ROSTER,            /* Browse a binary roster file in place */
+     STUDENT_IMPORT_CSV,             /* Import students from a CSV/TSV file */
      STUDENT_EXIT_PROGRAM            /* Exit program */
  } MainOptionStatus_TypeDef;
  
  /****************************************************************************** 
   * PROTOTYPES
   ******************************************************************************/
- static void inputDataStudent(Student *pStudent);
+ static void inputDataStudent(Student *pStudent, const int checkDuplicate);
+ static int isNameTaken(const char *name);
+ static void mainInput(void);
  static void outputDataStudent(LinkedList *pList);
  static void insertMenu(void);
  static void deleteMenu(void);
@@ -126,6 +126,9 @@
  static void mainMenu(void);
  static void saveToFile(LinkedList *pList, const char *filename);
  static void mainInsert(void);
+ static void rosterViewMenu(void);
+ static void outputRosterView(const RosterView *pView);
+ static void mainRosterView(void);
  static int getInputNumber(void);
  static double getDoubleNumber(void);
  static void getInputString(char *resultString, const int option);
@@ -145,6 +148,12 @@
  static char nameTargetDelete[50];   /* Target name for delete operations */
  static LinkedList listStudent;      /* Linked list of students */
  static Student studentParam;        /* Temporary student data */
+ static StudentColumns reportColumns; /* Columnar snapshot reused by reports */
+ static RosterView rosterView;       /* Read-only roster mapped from a file */
+ static ImportResult importResult;   /* Counters of the last CSV import */
+ static const Student *pPendingStudents; /* Students entered but not linked yet */
+ static int pendingCount;            /* Number of pending students */
+ static const Node *pEditedNode;     /* Node being edited, allowed to keep its own name */
  
  /****************************************************************************** 
   * CODE
@@ -155,24 +164,22 @@
   */
  int main(void) {
      initLinkedList(&listStudent); /* Initialize the linked list */
+     initStudentColumns(&reportColumns); /* Empty report snapshot */
+     enableNameIndex(&listStudent); /* O(1) name lookups; scans are used if this fails */
+     enablePositionIndex(&listStudent); /* O(log n) positional access */
+     setSortThreadCount(0); /* Large lists are sorted on every core */
      choice = 0;
      mainMenu(); /* Display main menu */
  
      while (choice != STUDENT_EXIT_PROGRAM) {
          if (choice < STUDENT_INPUT || choice > STUDENT_EXIT_PROGRAM) {
-             printf("Invalid choice. Please enter a number between 1 and 8.\n");
+             printf("Invalid choice. Please enter a number between 1 and 12.\n");
              mainMenu();
              continue;
          }
          switch (choice) {
              case STUDENT_INPUT:
-                 printf("\nEnter number of students: \n");
-                 numberStudent = getInputNumber();
-                 for (int i = 0; i < numberStudent; i++) {
-                     inputDataStudent(&studentParam);
-                     addTail(&listStudent, createNode(studentParam));
-                 }
-                 printf("\nSuccessfully added students to list.\n");
+                 mainInput();
                  break;
              case STUDENT_INSERT:
                  insertMenu();
@@ -241,14 +248,18 @@
                          case 1:
                              printf("\nEditing student at the head of list.\n");
                              printf("Enter new student data:\n");
-                             inputDataStudent(&studentParam);
+                             pEditedNode = listStudent.pHead;
+                             inputDataStudent(&studentParam, TRUE);
+                             pEditedNode = NULL;
                              editHead(&listStudent, studentParam);
                              printf("Successfully edited student at the head of list.\n");
                              break;
                          case 2:
                              printf("\nEditing student at the tail of list.\n");
                              printf("Enter new student data:\n");
-                             inputDataStudent(&studentParam);
+                             pEditedNode = listStudent.pTail;
+                             inputDataStudent(&studentParam, TRUE);
+                             pEditedNode = NULL;
                              editLast(&listStudent, studentParam);
                              printf("Successfully edited student at the tail of list.\n");
                              break;
@@ -257,7 +268,9 @@
                              scanf("%d", &pos);
                              getchar();
                              printf("Enter student information:\n");
-                             inputDataStudent(&studentParam);
+                             pEditedNode = findStudentAt(&listStudent, pos);
+                             inputDataStudent(&studentParam, TRUE);
+                             pEditedNode = NULL;
                              editSpecificPosition(&listStudent, pos, studentParam);
                              printf("Successfully edited student.\n");
                              break;
@@ -324,30 +337,121 @@
                  fileName[strcspn(fileName, "\n")] = 0;
                  saveToFile(&listStudent, fileName);
                  break;
+             case STUDENT_SAVE_BINARY:
+                 printf("Enter filename to save: ");
+                 fgets(fileName, 50, stdin);
+                 fileName[strcspn(fileName, "\n")] = 0;
+                 if (saveListBinary(&listStudent, fileName)) {
+                     printf("Data saved to %s successfully!\n", fileName);
+                 }
+                 break;
+             case STUDENT_LOAD_BINARY:
+                 printf("Enter filename to load: ");
+                 fgets(fileName, 50, stdin);
+                 fileName[strcspn(fileName, "\n")] = 0;
+                 if (loadListBinary(&listStudent, fileName)) {
+                     printf("Loaded %d students from %s successfully!\n", countNodes(&listStudent), fileName);
+                 }
+                 break;
+             case STUDENT_VIEW_ROSTER:
+                 printf("Enter filename to open: ");
+                 fgets(fileName, 50, stdin);
+                 fileName[strcspn(fileName, "\n")] = 0;
+                 if (openRosterView(&rosterView, fileName)) {
+                     printf("Opened %s with %d students.\n", fileName, rosterViewCount(&rosterView));
+                     rosterViewMenu();
+                     mainRosterView();
+                     closeRosterView(&rosterView);
+                 }
+                 break;
+             case STUDENT_IMPORT_CSV:
+                 printf("Enter filename to import: ");
+                 fgets(fileName, 50, stdin);
+                 fileName[strcspn(fileName, "\n")] = 0;
+                 printf("Enter filename for rejected rows: ");
+                 fgets(nameTarget, 50, stdin);
+                 nameTarget[strcspn(nameTarget, "\n")] = 0;
+                 if (importStudentsCsv(&listStudent, fileName, nameTarget, NULL, &importResult)) {
+                     printf("Imported %lu students, rejected %lu rows (see %s).\n",
+                            importResult.imported, importResult.rejected, nameTarget);
+                 }
+                 break;
              default:
                  printf("Invalid choice. Please enter again.\n");
          }
+ #ifndef NDEBUG
+         checkListConsistency(&listStudent); /* Debug builds: report a broken count or tail */
+ #endif
          mainMenu();
      }
      /* Free the linked list before exiting */
      freeLinkedList(&listStudent);
+     freeStudentColumns(&reportColumns);
+     destroyNodePool(getDefaultNodePool()); /* Release node slabs */
      printf("Program exited successfully. Press Enter to exit...\n");
      getchar();
      return 0;
  }
  
+ /**
+  * @brief Check whether a name is already in the list or among the pending students
+  * @param name Name to look for
+  * @return 1 if taken by another student, 0 otherwise
+  */
+ static int isNameTaken(const char *name) {
+     const Node *pFound = findStudentByName(&listStudent, name);
+     if (pFound != NULL && pFound != pEditedNode) return 1;
+     for (int i = 0; i < pendingCount; i++) {
+         if (strcmp(pPendingStudents[i].nameStudent, name) == 0) return 1;
+     }
+     return 0;
+ }
+ 
+ /**
+  * @brief Read several students and append them to the list as one block
+  */
+ static void mainInput(void) {
+     Student *pStudents = NULL;
+     printf("\nEnter number of students: \n");
+     numberStudent = getInputNumber();
+     if (numberStudent > 0) {
+         pStudents = (Student*)malloc((size_t)numberStudent * sizeof(Student));
+         if (pStudents == NULL) {
+             printf("Memory allocation failed!\n");
+             return;
+         }
+     }
+     pPendingStudents = pStudents;
+     for (pendingCount = 0; pendingCount < numberStudent; pendingCount++) {
+         inputDataStudent(&pStudents[pendingCount], TRUE); /* Also rejects names entered earlier in this batch */
+     }
+     if (buildListFromArray(&listStudent, pStudents, (size_t)pendingCount)) {
+         printf("\nSuccessfully added students to list.\n");
+     }
+     pPendingStudents = NULL;
+     pendingCount = 0;
+     free(pStudents);
+ }
+ 
  /**
   * @brief Input student data from user
   * @param pStudent Pointer to student structure to store input data
+  * @param checkDuplicate TRUE to reject names already in the list, except pEditedNode's
   */
- static void inputDataStudent(Student *pStudent) {
+ static void inputDataStudent(Student *pStudent, const int checkDuplicate) {
      printf("\nEnter name of student: ");
      getInputString(pStudent->nameStudent, GET_VALID_NAME);
+     while (checkDuplicate && isNameTaken(pStudent->nameStudent)) {
+         while (getchar() != '\n'); /* Drop the rest of the rejected line */
+         Error_Handler(ERROR_DUPLICATE_NAME);
+         printf("Enter name of student: ");
+         getInputString(pStudent->nameStudent, GET_VALID_NAME);
+     }
      printf("Enter age of student: ");
      pStudent->ageStudent = getInputNumber();
      printf("Enter GPA of student: ");
      pStudent->GPA = getDoubleNumber();
-     while (pStudent->GPA > MAX_GPA_SCALE || pStudent->GPA < MIN_GPA_SCALE) {
+     while (!isValidGpa(pStudent->GPA)) {
          printf("Invalid GPA. Enter again!\n-----------------------------------------------------\n");
          pStudent->GPA = getDoubleNumber();
      }
@@ -359,16 +463,21 @@
   * @param pList Pointer to the linked list
   */
  static void outputDataStudent(LinkedList *pList) {
-     int countStudent = 1;
-     printf("\n======================List of students=======================\n");
-     printf("No.\t%-30s\t%-10s\t%-10s\n", "Name", "Age", "GPA");
-     printf("=============================================================\n");
-     for (Node *pTemp = pList->pHead; pTemp != NULL; pTemp = pTemp->pNextNode) {
-         printf("%d\t%-30s\t%-10d\t%-10.2f\n", countStudent++,
-                pTemp->dataStudent.nameStudent,
-                pTemp->dataStudent.ageStudent,
-                pTemp->dataStudent.GPA);
-     }
+     ReportWriter writer;
+     initReportWriter(&writer, stdout);
+     writeStudentReport(&writer, pList, REPORT_FORMAT_CONSOLE, NULL);
+     finishReportWriter(&writer);
+ }
+ 
+ /**
+  * @brief Display the students of a roster view, reading them in place
+  * @param pView Pointer to the roster view
+  */
+ static void outputRosterView(const RosterView *pView) {
+     ReportWriter writer;
+     initReportWriter(&writer, stdout);
+     writeRosterViewReport(&writer, pView, REPORT_FORMAT_CONSOLE);
+     finishReportWriter(&writer);
  }
  
  /**
@@ -430,6 +539,21 @@
             "Enter your choice: ");
  }
  
+ /**
+  * @brief Display roster view menu
+  */
+ static void rosterViewMenu(void) {
+     printf("\n===== READ-ONLY ROSTER MENU =====\n"
+            "1. Output list of students\n"
+            "2. Sort students by name (A -> Z)\n"
+            "3. Sort students by score (Descending)\n"
+            "4. Sort students by age (Ascending)\n"
+            "5. Show GPA distribution\n"
+            "6. Edit student at specific position\n"
+            "7. Close roster and back to Main Menu\n"
+            "Enter your choice: ");
+ }
+ 
  /**
   * @brief Display main menu and get user choice
   */
@@ -442,47 +566,55 @@
             "5. Sort students in list.\n"
             "6. Output list of students.\n"
             "7. Save list to a file.\n"
-            "8. Exit.\n"
+            "8. Save list to a binary roster file.\n"
+            "9. Load list from a binary roster file.\n"
+            "10. Open a binary roster file read-only.\n"
+            "11. Import students from a CSV/TSV file.\n"
+            "12. Exit.\n"
             "==========================================================\n"
             "Enter your choice: ");
      choice = getInputNumber();
  }
  
  /**
-  * @brief Save student data to a text file with GPA distribution
+  * @brief Save student data to a file (table with GPA distribution, or CSV/JSON Lines by extension)
   * @param pList Pointer to the linked list
   * @param filename Name of the file to save
   */
  static void saveToFile(LinkedList *pList, const char *filename) {
-     int countStudent = 1;
-     int excellent = 0, good = 0, average = 0, weak = 0;
-     FILE *file = fopen(filename, "w");
+     GpaDistribution distribution = {0, 0, 0, 0};
+     ReportFormat_TypeDef format = REPORT_FORMAT_TABLE;
+     const char *extension = strrchr(filename, '.');
+     ReportWriter writer;
+     int written;
+     FILE *file;
+     if (extension != NULL && strcmp(extension, ".csv") == 0) format = REPORT_FORMAT_CSV;
+     if (extension != NULL && strcmp(extension, ".jsonl") == 0) format = REPORT_FORMAT_JSON_LINES;
+     if (format == REPORT_FORMAT_TABLE) {
+         if (refreshStudentColumns(&reportColumns, pList)) {
+             columnsGpaDistribution(&reportColumns, &distribution);
+         } else {
+             /* No memory for the snapshot: count from the list instead */
+             for (Node *pTemp = pList->pHead; pTemp != NULL; pTemp = pTemp->pNextNode) {
+                 if (pTemp->dataStudent.GPA >= 3.5) distribution.excellent++;
+                 else if (pTemp->dataStudent.GPA >= 3.0) distribution.good++;
+                 else if (pTemp->dataStudent.GPA >= 2.0) distribution.average++;
+                 else distribution.weak++;
+             }
+         }
+     }
+     file = fopen(filename, "w");
      if (file == NULL) {
          printf("Error opening file for writing.\n");
          return;
      }
-     fprintf(file, "========================================================\n");
-     fprintf(file, "| %-3s | %-50s | %-5s | %-7s |\n", "No.", "Name", "Age", "GPA");
-     fprintf(file, "========================================================\n");
-     for (Node *pTemp = pList->pHead; pTemp != NULL; pTemp = pTemp->pNextNode) {
-         fprintf(file, "| %-3d | %-50s | %-5d | %-7.2f |\n", countStudent++,
-                 pTemp->dataStudent.nameStudent,
-                 pTemp->dataStudent.ageStudent,
-                 pTemp->dataStudent.GPA);
-         if (pTemp->dataStudent.GPA >= 3.5) excellent++;
-         else if (pTemp->dataStudent.GPA >= 3.0) good++;
-         else if (pTemp->dataStudent.GPA >= 2.0) average++;
-         else weak++;
+     initReportWriter(&writer, file);
+     writeStudentReportParallel(&writer, pList, format, &distribution, 0);
+     written = finishReportWriter(&writer);
+     if (fclose(file) != 0 || !written) {
+         printf("Error writing to file!\n");
+         return;
      }
-     fprintf(file, "============================================\n\n");
-     fprintf(file, "                   GPA DISTRIBUTION\n");
-     fprintf(file, "========================================================\n");
-     fprintf(file, "| %-54s | %-5d |\n", "Excellent (3.5 - 4.0)", excellent);
-     fprintf(file, "| %-54s | %-5d |\n", "Good (3.0 - 3.49)", good);
-     fprintf(file, "| %-54s | %-5d |\n", "Average (2.0 - 2.99)", average);
-     fprintf(file, "| %-54s | %-5d |\n", "Weak (< 2.0)", weak);
-     fprintf(file, "========================================================\n");
-     fclose(file);
      printf("Data saved to %s successfully!\n", filename);
  }
  
@@ -495,13 +627,13 @@
          switch (insertChoice) {
              case 1:
                  printf("\nEnter information of student to insert at head of list\n");
-                 inputDataStudent(&studentParam);
+                 inputDataStudent(&studentParam, TRUE);
                  addHead(&listStudent, createNode(studentParam));
                  printf("Successfully inserted student to head of list.\n");
                  break;
              case 2:
                  printf("\nEnter information of student to insert at tail of list\n");
-                 inputDataStudent(&studentParam);
+                 inputDataStudent(&studentParam, TRUE);
                  addTail(&listStudent, createNode(studentParam));
                  printf("Successfully inserted student to tail of list.\n");
                  break;
@@ -510,7 +642,7 @@
                  fgets(nameTarget, 50, stdin);
                  nameTarget[strcspn(nameTarget, "\n")] = 0;
                  printf("Enter information of new student:\n");
-                 inputDataStudent(&studentParam);
+                 inputDataStudent(&studentParam, TRUE);
                  insertBeforeStudent(&listStudent, studentParam, nameTarget);
                  printf("Successfully inserted student.\n");
                  break;
@@ -519,7 +651,7 @@
                  fgets(nameTarget, 50, stdin);
                  nameTarget[strcspn(nameTarget, "\n")] = 0;
                  printf("Enter information of new student:\n");
-                 inputDataStudent(&studentParam);
+                 inputDataStudent(&studentParam, TRUE);
                  insertAfterStudent(&listStudent, studentParam, nameTarget);
                  printf("Successfully inserted student.\n");
                  break;
@@ -527,7 +659,7 @@
                  printf("\nEnter position to insert: ");
                  pos = getInputNumber();
                  printf("Enter student information:\n");
-                 inputDataStudent(&studentParam);
+                 inputDataStudent(&studentParam, TRUE);
                  int count = countNodes(&listStudent);
                  if (pos < 0) {
                      printf("Invalid position! Please enter a value from 1 to %d.\n", count);
@@ -547,6 +679,62 @@
      }
  }
  
+ /**
+  * @brief Handle operations on the read-only roster view
+  */
+ static void mainRosterView(void) {
+     static const SortKey byName = { SORT_FIELD_NAME, SORT_ASCENDING };
+     static const SortKey byScore = { SORT_FIELD_GPA, SORT_DESCENDING };
+     static const SortKey byAge = { SORT_FIELD_AGE, SORT_ASCENDING };
+     StudentAggregates stats;
+     int viewChoice = getInputNumber();
+     while (viewChoice != 7) {
+         switch (viewChoice) {
+             case 1:
+                 outputRosterView(&rosterView);
+                 break;
+             case 2:
+                 if (rosterViewSort(&rosterView, &byName, 1)) {
+                     printf("Students sorted by name (A → Z) successfully!\n");
+                 }
+                 break;
+             case 3:
+                 if (rosterViewSort(&rosterView, &byScore, 1)) {
+                     printf("Students sorted by score (Descending) successfully!\n");
+                 }
+                 break;
+             case 4:
+                 if (rosterViewSort(&rosterView, &byAge, 1)) {
+                     printf("Students sorted by age (Ascending) successfully!\n");
+                 }
+                 break;
+             case 5:
+                 rosterViewAggregate(&rosterView, &stats);
+                 printf("\n                   GPA DISTRIBUTION\n");
+                 printf("========================================================\n");
+                 printf("| %-54s | %-5d |\n", "Excellent (3.5 - 4.0)", stats.excellent);
+                 printf("| %-54s | %-5d |\n", "Good (3.0 - 3.49)", stats.good);
+                 printf("| %-54s | %-5d |\n", "Average (2.0 - 2.99)", stats.average);
+                 printf("| %-54s | %-5d |\n", "Weak (< 2.0)", stats.weak);
+                 printf("========================================================\n");
+                 break;
+             case 6:
+                 printf("\nEnter position to edit: ");
+                 pos = getInputNumber();
+                 printf("Enter student information:\n");
+                 inputDataStudent(&studentParam, FALSE);
+                 if (rosterViewEditPosition(&rosterView, pos, studentParam)) {
+                     printf("Successfully edited student (the file is not changed).\n");
+                 }
+                 break;
+             default:
+                 printf("Invalid choice! Please try again.\n");
+         }
+         rosterViewMenu();
+         viewChoice = getInputNumber();
+     }
+ }
+ 
  /**
  * @brief Get an integer input from user
  * @return The input number
@@ -640,28 +828,32 @@
         }
         resultString[49] = '\0'; // Ensure null termination
 
-        int spaceFound = FALSE;
+        if (option == GET_VALID_NAME) {
+            // One definition of a valid name, shared with the CSV import
+            isValid = (validateStudentName(resultString, strlen(resultString)) == IMPORT_ROW_OK);
+            if (!isValid) {
+                Error_Handler(ERROR_INVALID_NAME);
+                while (getchar() != '\n'); // Clear buffer after invalid input
+            }
+            continue;
+        }
+
         int alphaFound = FALSE;
         int nameLength = 0;
         isValid = TRUE;
         for (int i = 0; resultString[i] != '\0' && isValid && i < 49; i++, nameLength++) {
             if (resultString[i] == ' ') {
-                if (option == GET_VALID_ACCOUNT || (spaceFound && option == GET_VALID_NAME) || i == 0) {
+                if (option == GET_VALID_ACCOUNT || i == 0) {
                     Error_Handler(ERROR_INVALID_NAME);
                     isValid = FALSE;
                 }
-                spaceFound = TRUE;
             } else if (IS_ALPHA(resultString[i])) {
-                spaceFound = FALSE;
                 alphaFound = TRUE;
             } else if (option == GET_VALID_ACCOUNT && IS_DIGIT(resultString[i])) {
-                spaceFound = FALSE;
+                // Digits are allowed in account names
             } else {
                 // Only trigger specific errors for valid options, otherwise skip validation
-                if (option == GET_VALID_NAME) {
-                    Error_Handler(ERROR_INVALID_NAME);
-                    isValid = FALSE;
-                } else if (option == GET_VALID_ACCOUNT) {
+                if (option == GET_VALID_ACCOUNT) {
                     Error_Handler(ERROR_INVALID_ACCOUNT);
                     isValid = FALSE;
                 } else {
@@ -672,10 +864,7 @@
             }
         }
         if (isValid) {
-            if (option == GET_VALID_NAME && nameLength < MIN_NAME_LENGTH) {
-                Error_Handler(ERROR_INVALID_NAME);
-                isValid = FALSE;
-            } else if (option == GET_VALID_ACCOUNT && (nameLength < MIN_ACCOUNT_LENGTH || !alphaFound)) {
+            if (option == GET_VALID_ACCOUNT && (nameLength < MIN_ACCOUNT_LENGTH || !alphaFound)) {
                 Error_Handler(ERROR_INVALID_ACCOUNT);
                 isValid = FALSE;
             }